@@ -103,12 +103,20 @@ run -g -q -p
 run --no-unlocked -q
 run --no-unlocked -a -p
 
+run --no-threads -q
+run --no-threads -a -p
+
 run --no-contracts -q
 run --no-contracts -a -p
 
 run --no-tracing -q
 run --no-tracing -a -p
 
+run --compact-watches -q
+run --compact-watches -a -p
+run --hot-vars -q
+run --hot-vars -a -p
+
 run -m32 -q
 run -m32 -a -p
 
@@ -557,7 +557,7 @@ inline int Internal::find_conflict_level (int &forced) {
 
     if (highest_position > 1) {
       LOG (conflict, "unwatch %d in", lit);
-      remove_watch (watches (lit), conflict);
+      unwatch_literal (lit, conflict);
     }
 
     lits[highest_position] = lit;
@@ -619,9 +619,9 @@ inline int Internal::determine_actual_backtrack_level (int jump) {
         }
       } else {
         for (int l = jump + 1; l <= level; l++) {
-          const auto &t = next_trail (l);
-          for (size_t i = 0; i < t->size (); i++) {
-            const auto idx = abs ((*t)[i]);
+          const int size = trail_size (l);
+          for (int i = 0; i < size; i++) {
+            const auto idx = abs (trail_lit (l, i));
             if (var (idx).level < l)
               continue;
             if (best_idx && !score_smaller (this) (best_idx, idx))
@@ -644,9 +644,9 @@ inline int Internal::determine_actual_backtrack_level (int jump) {
         }
       } else {
         for (int l = jump + 1; l <= level; l++) {
-          const auto &t = next_trail (l);
-          for (size_t i = 0; i < t->size (); i++) {
-            const auto idx = abs ((*t)[i]);
+          const int size = trail_size (l);
+          for (int i = 0; i < size; i++) {
+            const auto idx = abs (trail_lit (l, i));
             if (var (idx).level < l)
               continue;
             if (best_idx && bumped (best_idx) >= bumped (idx))
@@ -773,8 +773,8 @@ Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
   LOG (new_conflict, "putting uip at pos 1");
 
   if (other_init != other)
-    remove_watch (watches (other_init), new_conflict);
-  remove_watch (watches (uip), new_conflict);
+    unwatch_literal (other_init, new_conflict);
+  unwatch_literal (uip, new_conflict);
 
   assert (!lrat || lrat_chain.back () == new_conflict->id);
   if (lrat) {
@@ -819,7 +819,7 @@ Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
   if (other_init != other)
     watch_literal (other, lits[1], new_conflict);
   else {
-    update_watch_size (watches (other), lits[1], new_conflict);
+    update_watch_size (other, lits[1], new_conflict);
   }
   watch_literal (lits[1], other, new_conflict);
 
@@ -1013,12 +1013,11 @@ void Internal::analyze () {
   // for multitrail we only need to analyze the trail with the conflicting
   // level which is also level because we backtracked earlier.
 
-  const auto &t = next_trail (level);
-  int i = t->size ();      // Start at end-of-trail.
-  int open = 0;            // Seen but not processed on this level.
-  int uip = 0;             // The first UIP literal.
-  int resolvent_size = 0;  // without the uip
-  int antecedent_size = 1; // with the uip and without unit literals
+  int i = trail_size (level); // Start at end-of-trail.
+  int open = 0;               // Seen but not processed on this level.
+  int uip = 0;                // The first UIP literal.
+  int resolvent_size = 0;     // without the uip
+  int antecedent_size = 1;    // with the uip and without unit literals
   int conflict_size =
       0; // size of the conflict without the uip and without unit literals
   int resolved = 0; // number of resolution (0 = clause in CNF)
@@ -1092,7 +1091,7 @@ void Internal::analyze () {
   uip = 0;
   while (!uip) {
     assert (i > 0);
-    const int lit = (*t)[--i];
+    const int lit = trail_lit (level, --i);
     if (!flags (lit).seen)
       continue;
     if (var (lit).level == level)
@@ -1174,6 +1173,8 @@ void Internal::analyze () {
 
   int new_level = determine_actual_backtrack_level (jump);
   UPDATE_AVERAGE (averages.current.level, new_level);
+  if (opts.trailsave && new_level < level)
+    save_trail (new_level);
   backtrack (new_level);
 
   // It should hold that (!level <=> size == 1)
@@ -1,5 +1,10 @@
 #include "internal.hpp"
 
+#ifdef COMPACT_WATCHES
+#include <sys/mman.h>
+#include <sys/resource.h>
+#endif
+
 namespace CaDiCaL {
 
 Arena::Arena (Internal *i) {
@@ -7,9 +12,52 @@ Arena::Arena (Internal *i) {
   internal = i;
 }
 
+#ifndef COMPACT_WATCHES
+
 Arena::~Arena () {
   delete[] from.start;
   delete[] to.start;
+  while (blocks) {
+    Block *next = blocks->next;
+    delete[] (char *) blocks;
+    blocks = next;
+  }
+}
+
+// Allocate a new block for new clauses which is at least twice as large as
+// the previous one (starting with 1 MB).  The rest of the previous block
+// is wasted until the next 'swap'.
+
+void Arena::grow (size_t bytes) {
+  size_t size = blocks ? 2 * (blocks->end - (char *) blocks) : (1 << 20);
+  if (size < bytes + sizeof (Block))
+    size = bytes + sizeof (Block);
+  LOG ("allocating new arena block of %zd bytes", size);
+  Block *b = (Block *) new char[size];
+  b->next = blocks;
+  b->end = (char *) b + size;
+  blocks = b;
+  fresh = (char *) (b + 1);
+  limit = b->end;
+}
+
+// All clauses in blocks are dead after the moving garbage collector copied
+// all surviving clauses to 'to' space.  Then we only keep the last (and
+// largest) block for allocating new clauses.
+
+void Arena::reset () {
+  memset (free_lists, 0, sizeof free_lists);
+  if (!blocks)
+    return;
+  Block *b = blocks->next;
+  while (b) {
+    Block *next = b->next;
+    delete[] (char *) b;
+    b = next;
+  }
+  blocks->next = 0;
+  fresh = (char *) (blocks + 1);
+  limit = blocks->end;
 }
 
 void Arena::prepare (size_t bytes) {
@@ -25,6 +73,71 @@ void Arena::swap () {
        (size_t) (from.end - from.start));
   from = to;
   to.start = to.top = to.end = 0;
+  reset ();
+}
+
+#else
+
+Arena::~Arena () {
+  if (base)
+    munmap (base, 2 * half);
+}
+
+// Reserve address space for both halves.  References have 31 bits (one bit
+// of a watch reference is used for the binary flag) in units of 8 bytes,
+// which gives at most 16 GB.  Pages are only mapped when touched.  If the
+// address space is limited (for instance by the model based tester) we
+// only take a fraction of it and otherwise try smaller sizes.
+
+void Arena::reserve () {
+  assert (!base);
+  size_t bytes = (size_t) 1 << (sizeof (size_t) > 4 ? 34 : 30);
+  struct rlimit rlim;
+  if (!getrlimit (RLIMIT_AS, &rlim) && rlim.rlim_cur != RLIM_INFINITY &&
+      rlim.rlim_cur / 8 < bytes)
+    bytes = rlim.rlim_cur / 8;
+  for (;;) {
+    bytes &= ~(size_t) 15;
+    if (bytes < (1 << 20))
+      fatal ("can not reserve clause arena memory");
+    void *p = mmap (0, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p != MAP_FAILED) {
+      base = (char *) p;
+      break;
+    }
+    bytes /= 2;
+  }
+  half = bytes / 2;
+  LOG ("reserved %zd bytes for clause arena", bytes);
+  from.start = from.top = fresh = base;
+  from.end = base + half;
+}
+
+void Arena::exhausted () {
+  fatal ("clause arena of %zd bytes exhausted (compact watches)", half);
+}
+
+void Arena::prepare (size_t bytes) {
+  LOG ("preparing 'to' space of arena with %zd bytes", bytes);
+  if (!base)
+    reserve ();
+  assert (!to.start);
+  to.top = to.start = (from.start == base ? base + half : base);
+  to.end = to.start + half;
+  if (bytes > half)
+    exhausted ();
+}
+
+void Arena::swap () {
+  LOG ("release 'from' space of arena with %zd bytes",
+       (size_t) (fresh - from.start));
+  madvise (from.start, fresh - from.start, MADV_DONTNEED);
+  from = to;
+  fresh = from.top;
+  to.start = to.top = to.end = 0;
 }
 
+#endif
+
 } // namespace CaDiCaL
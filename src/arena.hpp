@@ -51,6 +51,26 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// With 'opts.arenanew' new clauses are not allocated on the heap either,
+// but with 'allocate' in a list of growing blocks with a bump pointer.
+// Thus learned clauses are placed consecutively in memory in the order
+// they are learned instead of being scattered over the heap.  Clauses in
+// these blocks which are deleted by the non-moving garbage collector
+// (usually after 'reduce') are put on free lists of their size class
+// (clauses with the same number of bytes) and reused by 'allocate'.  Since
+// the moving garbage collector copies all surviving clauses to 'to' space,
+// all blocks are reset in 'swap' (and only the last one is kept).
+
+// With compact watches ('COMPACT_WATCHES' see 'watch.hpp') all clauses
+// are allocated in the arena and watches refer to them by 32-bit
+// references, i.e., offsets in units of 8 bytes.  Then both spaces are two
+// halves of one reserved (virtual) memory region of at most 16 GB and
+// never move.  New clauses are allocated with 'allocate' after the clauses
+// copied into 'from' during the last garbage collection.  Clauses are never
+// deallocated individually.  Their memory is reclaimed by the next moving
+// garbage collection, which in this mode is always used.
+
+struct Clause;
 struct Internal;
 
 class Arena {
@@ -61,6 +81,33 @@ class Arena {
     char *start, *top, *end;
   } from, to;
 
+#ifdef COMPACT_WATCHES
+  char *base;   // start of reserved memory for both spaces
+  size_t half;  // size of reserved memory of each space
+  char *fresh;  // allocation of new clauses in 'from' starts here
+
+  void reserve ();
+  void exhausted ();
+#else
+  struct Block {
+    Block *next; // previously allocated (smaller) block
+    char *end;   // end of this block
+  };
+
+  Block *blocks;       // last allocated block of new clauses
+  char *fresh, *limit; // bump pointer allocation in 'blocks'
+
+  // Free lists of deleted clauses in blocks by size class (in units of 8
+  // bytes) linked through their first 8 bytes.  Larger clauses are only
+  // reclaimed by resetting the blocks in 'swap'.
+  //
+  static const size_t max_free_bytes = 512;
+  char *free_lists[max_free_bytes / 8 + 1];
+
+  void grow (size_t bytes);
+  void reset ();
+#endif
+
 public:
   Arena (Internal *);
   ~Arena ();
@@ -92,6 +139,79 @@ public:
     return res;
   }
 
+#ifdef COMPACT_WATCHES
+
+  // Allocate a new clause in 'from' space after the copied clauses.
+  //
+  char *allocate (size_t bytes) {
+    if (!base)
+      reserve ();
+    if ((size_t) (from.end - fresh) < bytes)
+      exhausted ();
+    char *res = fresh;
+    fresh += bytes;
+    return res;
+  }
+
+  // Translate between clauses and their references (in both spaces).
+  //
+  unsigned reference (const Clause *c) const {
+    const char *p = (const char *) c;
+    assert (base <= p), assert (p < base + 2 * half);
+    assert (!((p - base) & 7));
+    return (p - base) >> 3;
+  }
+  Clause *clause (unsigned ref) const {
+    return (Clause *) (base + ((size_t) ref << 3));
+  }
+
+#else
+
+  // Allocate a new clause in blocks (see 'opts.arenanew' above).
+  //
+  char *allocate (size_t bytes) {
+    assert (!(bytes & 7));
+    if (bytes <= max_free_bytes) {
+      char *&list = free_lists[bytes / 8];
+      if (list) {
+        char *res = list;
+        list = *(char **) res;
+        return res;
+      }
+    }
+    if ((size_t) (limit - fresh) < bytes)
+      grow (bytes);
+    char *res = fresh;
+    fresh += bytes;
+    return res;
+  }
+
+  // Was the memory pointed to by 'p' obtained with 'allocate'?  The
+  // number of blocks is logarithmic in the memory used, since block sizes
+  // are doubled.
+  //
+  bool allocated (const void *p) const {
+    const char *c = (const char *) p;
+    for (const Block *b = blocks; b; b = b->next)
+      if ((const char *) (b + 1) <= c && c < b->end)
+        return true;
+    return false;
+  }
+
+  // Put a deleted clause allocated with 'allocate' on its free list.
+  //
+  void release (char *p, size_t bytes) {
+    assert (allocated (p));
+    assert (!(bytes & 7));
+    if (bytes > max_free_bytes)
+      return;
+    char *&list = free_lists[bytes / 8];
+    *(char **) p = list;
+    list = p;
+  }
+
+#endif
+
   // Completely delete 'from' space and then replace 'from' by 'to' (by
   // pointer swapping).  Everything previously allocated (in 'from') and not
   // explicitly copied to 'to' with 'copy' becomes invalid.
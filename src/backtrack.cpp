@@ -73,6 +73,44 @@ void Internal::update_target_and_best () {
 
 /*------------------------------------------------------------------------*/
 
+// Save the literals assigned above 'new_level' with their reasons before
+// back-jumping in 'analyze' (see 'saved.hpp').  With 'opts.reimply' the
+// levels are saved one after the other and elevated literals only on the
+// level they are currently assigned on.  Literals kept by chronological
+// backtracking are not saved either.  The order of the saved trail thus
+// still guarantees that reasons only contain literals which are assigned
+// before or are saved before the implied literal.
+
+void Internal::save_trail (int new_level) {
+  assert (opts.trailsave);
+  assert (new_level < level);
+  saved_trail.clear ();
+  const auto save = [this] (int lit) {
+    const Var &v = var (lit);
+    Clause *reason = v.reason;
+    if (reason == external_reason)
+      reason = 0;
+    saved_trail.push (lit, reason);
+  };
+  if (opts.reimply && !trails.empty ()) {
+    for (int l = new_level + 1; l <= level; l++)
+      for (const int *p = trails.begin (l); p != trails.end (l); p++)
+        if (var (*p).level == l)
+          save (*p);
+  } else {
+    const size_t end = trail.size ();
+    for (size_t i = control[new_level + 1].trail; i < end; i++)
+      if (var (trail[i]).level > new_level)
+        save (trail[i]);
+  }
+  stats.trailsave.saves++;
+  stats.trailsave.saved += saved_trail.entries.size ();
+  LOG ("saved %zd literals of trail above level %d",
+       saved_trail.entries.size (), new_level);
+}
+
+/*------------------------------------------------------------------------*/
+
 void Internal::backtrack (int new_level) {
 
   assert (new_level <= level);
@@ -149,6 +187,8 @@ void Internal::backtrack (int new_level) {
     propagated = assigned;
   if (propagated2 > assigned)
     propagated2 = assigned;
+  if (gauss.propagated > assigned)
+    gauss.propagated = assigned;
   if (no_conflict_until > assigned)
     no_conflict_until = assigned;
 
@@ -185,8 +225,8 @@ void Internal::multi_backtrack (int new_level) {
     assert (i >= 0); // check that loop is safe for level = INT_MAX
     int l = i + 1;
     LOG ("unassigning level %d", l);
-    auto &t = trails[i];
-    for (auto &lit : t) {
+    for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+      const int lit = *p;
       LOG ("unassigning literal %d", lit);
       if (!lit) { // cannot happen
         assert (false);
@@ -246,7 +286,6 @@ void Internal::multi_backtrack (int new_level) {
     multitrail_dirty = new_level;
   propergated = 0; // Always go back to root-level.
   clear_trails (new_level);
-  multitrail.resize (new_level);
   control.resize (new_level + 1);
   level = new_level;
   if (tainted_literal) {
@@ -0,0 +1,508 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Bounded variable addition following 'SimpleBVA' as described in
+// "Automated Reencoding of Boolean Formulas" by Norbert Manthey, Marijn
+// Heule and Armin Biere (HVC'12).  It factors a set of clauses
+//
+//   (l_i | C_j)   for all 1 <= i <= m and 1 <= j <= n
+//
+// into the 'm + n' clauses
+//
+//   (-x | l_i)    for all 1 <= i <= m and
+//   (x | C_j)     for all 1 <= j <= n
+//
+// with a fresh variable 'x', which removes 'm*n - m - n' clauses.  Starting
+// with the literal 'l_1' with most occurrences, the literals 'l_i' are
+// found greedily, by adding in each step the literal which can replace
+// 'l_1' in most of the remaining clauses 'C_j' as long the reduction
+// increases.  The new variable is only visible internally and gets an
+// external index beyond the user variables (see 'External::introduce').
+//
+// In the proof we first add the clauses '(-x | l_i)' and the clause
+// '(x | -l_1 | ... | -l_m)', which are all blocked on their first literal
+// (as in extended resolution).  Then the clauses '(x | C_j)' are derived by
+// unit propagation from the factored clauses and this last definition,
+// which is deleted afterwards.  Proof formats which can not express such
+// definitions disable bounded variable addition.
+
+/*------------------------------------------------------------------------*/
+
+// Literals with most occurrences are tried first.
+
+inline bool bva_fewer_occs::operator() (unsigned a, unsigned b) {
+  const int64_t s = internal->noccs (internal->u2i (a));
+  const int64_t t = internal->noccs (internal->u2i (b));
+  if (s < t)
+    return true;
+  if (s > t)
+    return false;
+  return a > b;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Connect irredundant clauses without root level assigned literals and
+// schedule all literals occurring at least twice.
+
+void Internal::bva_schedule (Factorizer &factorizer) {
+  for (const auto &c : clauses) {
+    if (c->garbage || c->redundant)
+      continue;
+    bool assigned = false;
+    for (const auto &lit : *c)
+      if (val (lit)) {
+        assigned = true;
+        break;
+      }
+    if (assigned)
+      continue;
+    for (const auto &lit : *c)
+      occs (lit).push_back (c), noccs (lit)++;
+  }
+  for (auto idx : vars) {
+    if (!active (idx))
+      continue;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if (noccs (lit) > 1)
+        factorizer.schedule.push_back (vlit (lit));
+    }
+  }
+  LOG ("scheduled %zd literals", factorizer.schedule.size ());
+}
+
+void Internal::bva_connect_clause (Factorizer &factorizer, Clause *c) {
+  LOG (c, "bva connecting");
+  for (const auto &lit : *c) {
+    occs (lit).push_back (c);
+    noccs (lit)++;
+    const unsigned u = vlit (lit);
+    if (factorizer.schedule.contains (u))
+      factorizer.schedule.update (u);
+    else if (noccs (lit) > 1)
+      factorizer.schedule.push_back (u);
+  }
+  mark_added (c);
+  stats.bva.added++;
+}
+
+void Internal::bva_remove_clause (Factorizer &factorizer, Clause *c) {
+  LOG (c, "bva removing");
+  for (const auto &lit : *c) {
+    assert (noccs (lit) > 0);
+    noccs (lit)--;
+    const unsigned u = vlit (lit);
+    if (factorizer.schedule.contains (u))
+      factorizer.schedule.update (u);
+  }
+  mark_garbage (c);
+  stats.bva.removed++;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Find the matching clauses for 'lit' and return 'true' if factoring them
+// reduces the number of clauses.  Candidate clauses for a matched clause
+// 'c' are found in the occurrence list of the literal in 'c' (besides
+// 'lit') with the fewest occurrences, and match if all their literals are
+// marked except for the one replacing 'lit'.
+
+bool Internal::bva_match_literal (Factorizer &factorizer, int lit) {
+
+  vector<int> &lits = factorizer.lits;
+  vector<Clause *> &rows = factorizer.rows;
+  vector<Clause *> &next = factorizer.next;
+  auto &candidates = factorizer.candidates;
+
+  lits.clear ();
+  rows.clear ();
+  lits.push_back (lit);
+  const Occs &os = occs (lit);
+  stats.ticks.bva += 1 + cache_lines (os);
+  for (const auto &c : os)
+    if (!c->garbage)
+      rows.push_back (c);
+
+  int64_t reduction = -1; // Factoring 'm' literals from 'n' clauses
+  bool limited = false;   // removes 'm*n - m - n' clauses.
+
+  for (;;) {
+
+    const size_t m = lits.size (), n = rows.size () / m;
+    candidates.clear ();
+
+    for (size_t row = 0; !limited && row < n; row++) {
+      Clause *c = rows[row * m];
+      int min_lit = 0;
+      int64_t min_occs = 0;
+      for (const auto &other : *c) {
+        if (other == lit)
+          continue;
+        mark (other);
+        const int64_t tmp = noccs (other);
+        if (min_lit && min_occs <= tmp)
+          continue;
+        min_lit = other;
+        min_occs = tmp;
+      }
+      assert (min_lit);
+      const Occs &ds = occs (min_lit);
+      stats.ticks.bva += 1 + cache_lines (ds);
+      for (const auto &d : ds) {
+        if (d == c || d->garbage || d->size != c->size)
+          continue;
+        stats.ticks.bva++;
+        int replaced = 0;
+        for (const auto &other : *d) {
+          if (marked (other) > 0)
+            continue;
+          if (replaced) {
+            replaced = 0;
+            break;
+          }
+          replaced = other;
+        }
+        if (!replaced || replaced == lit || replaced == -lit)
+          continue;
+        if (find (lits.begin (), lits.end (), replaced) != lits.end ())
+          continue;
+        candidates.push_back ({replaced, (unsigned) row, d});
+      }
+      unmark (c);
+      limited = stats.ticks.bva > factorizer.limit;
+    }
+
+    if (limited || candidates.empty ())
+      break;
+
+    // Find the literal replacing 'lit' in most matched clauses.
+
+    sort (candidates.begin (), candidates.end (),
+          [] (const Factorizer::Candidate &a,
+              const Factorizer::Candidate &b) {
+            return a.lit < b.lit || (a.lit == b.lit && a.row < b.row);
+          });
+
+    int best = 0;
+    int64_t count = 0;
+    const auto end = candidates.end ();
+    for (auto i = candidates.begin (), j = i; i != end; i = j) {
+      int64_t tmp = 1;
+      for (j = i + 1; j != end && j->lit == i->lit; j++)
+        if (j->row != j[-1].row)
+          tmp++;
+      if (tmp <= count)
+        continue;
+      best = i->lit;
+      count = tmp;
+    }
+
+    const int64_t k = m + 1;
+    const int64_t tmp = k * count - k - count;
+    if (tmp <= reduction)
+      break;
+
+    LOG ("matching %d with %" PRId64 " clauses reduces %" PRId64
+         " clauses",
+         best, count, tmp);
+
+    next.clear ();
+    unsigned prev = UINT_MAX;
+    for (const auto &candidate : candidates) {
+      if (candidate.lit != best || candidate.row == prev)
+        continue;
+      prev = candidate.row;
+      const auto begin = rows.begin () + candidate.row * m;
+      next.insert (next.end (), begin, begin + m);
+      next.push_back (candidate.clause);
+    }
+    lits.push_back (best);
+    swap (rows, next);
+    reduction = tmp;
+  }
+
+  return !limited && reduction > 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Replace the matched clauses by the factored clauses on the new variable
+// 'idx' (see the explanation at the top of this file).
+
+void Internal::bva_add_clauses (Factorizer &factorizer, int idx) {
+
+  const vector<int> &lits = factorizer.lits;
+  const vector<Clause *> &rows = factorizer.rows;
+  const size_t m = lits.size (), n = rows.size () / m;
+  assert (clause.empty ());
+  assert (lrat_chain.empty ());
+
+  for (const auto &lit : lits) {
+    clause.push_back (-idx);
+    clause.push_back (lit);
+    Clause *c = new_resolved_irredundant_clause ();
+    clause.clear ();
+    bva_connect_clause (factorizer, c);
+  }
+
+  uint64_t id = 0;
+  vector<int> definition;
+  if (proof) {
+    id = ++clause_id;
+    definition.push_back (idx);
+    for (const auto &lit : lits)
+      definition.push_back (-lit);
+    proof->add_derived_clause (id, false, definition, lrat_chain);
+  }
+
+  for (size_t row = 0; row < n; row++) {
+    Clause *const *matched = &rows[row * m];
+    clause.push_back (idx);
+    for (const auto &other : *matched[0])
+      if (other != lits[0])
+        clause.push_back (other);
+    Clause *c = new_resolved_irredundant_clause ();
+    clause.clear ();
+    bva_connect_clause (factorizer, c);
+  }
+
+  if (proof)
+    proof->delete_clause (id, false, definition);
+
+  for (const auto &c : rows)
+    if (!c->garbage) // Duplicated clauses might be matched twice.
+      bva_remove_clause (factorizer, c);
+}
+
+void Internal::bva_literal (Factorizer &factorizer, int lit) {
+
+  if (!bva_match_literal (factorizer, lit))
+    return;
+
+  // Enlarging the internal solver while introducing the variable also
+  // allocates the (reset) watch tables, and does not know about the
+  // occurrence lists and counters used here.
+  //
+  const int idx = external->introduce ();
+  if (watching ())
+    reset_watches ();
+  if (otab.size () < 2 * vsize)
+    otab.resize (2 * vsize, Occs ());
+  if (ntab.size () < 2 * vsize)
+    ntab.resize (2 * vsize, 0);
+  mark_active (idx);
+  stats.bva.vars++;
+
+  LOG ("factoring %zd literals out of %zd clauses with new variable %d",
+       factorizer.lits.size (),
+       factorizer.rows.size () / factorizer.lits.size (), idx);
+
+  bva_add_clauses (factorizer, idx);
+
+  const unsigned u = vlit (lit);
+  if (noccs (lit) > 1 && !factorizer.schedule.contains (u))
+    factorizer.schedule.push_back (u);
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::bva () {
+
+  if (!opts.bva)
+    return;
+  if (unsat)
+    return;
+  if (terminated_asynchronously ())
+    return;
+  if (last.bva.added == stats.added.irredundant)
+    return;
+
+  // Definitions can not be expressed in these proof formats (LRAT would
+  // need resolution candidates for the RAT steps), checking learned clauses
+  // against a given solution would fail for the new variables and the
+  // external propagator should only see user variables.
+  //
+  if (lrat || opts.lrat || lratbuilder || opts.veripb || opts.frat ||
+      opts.idrup) {
+    if (!last.bva.ignored)
+      VERBOSE (1, "ignoring '--bva' since it does not support "
+                  "LRAT, FRAT, VeriPB and IDRUP proofs");
+    last.bva.ignored = true;
+    return;
+  }
+  if (external->solution)
+    return;
+  if (external_prop)
+    return;
+
+  if (propagated < trail.size ()) {
+    LOG ("need to propagate %zd units first", trail.size () - propagated);
+    init_watches ();
+    connect_watches ();
+    if (!propagate ()) {
+      LOG ("propagating units results in empty clause");
+      learn_empty_clause ();
+      assert (unsat);
+    }
+    clear_watches ();
+    reset_watches ();
+    if (unsat)
+      return;
+  }
+
+  START_SIMPLIFIER (bva, BVA);
+  stats.bva.count++;
+
+  assert (!level);
+  assert (!watching ());
+  assert (!occurring ());
+
+  mark_satisfied_clauses_as_garbage ();
+
+  init_occs ();
+  init_noccs ();
+
+  Factorizer factorizer (this);
+
+  int64_t delta = stats.ticks.search * 1e-3 * opts.bvareleff;
+  if (delta < opts.bvamineff)
+    delta = opts.bvamineff;
+  if (delta > opts.bvamaxeff)
+    delta = opts.bvamaxeff;
+  factorizer.limit = stats.ticks.bva + delta;
+
+  PHASE ("bva", stats.bva.count, "limit of %" PRId64 " ticks", delta);
+
+  bva_schedule (factorizer);
+
+  const int64_t vars = stats.bva.vars;
+  const int64_t added = stats.bva.added;
+  const int64_t removed = stats.bva.removed;
+
+  while (!terminated_asynchronously () && !factorizer.schedule.empty () &&
+         stats.ticks.bva <= factorizer.limit) {
+    const int lit = u2i (factorizer.schedule.front ());
+    factorizer.schedule.pop_front ();
+    if (noccs (lit) > 1)
+      bva_literal (factorizer, lit);
+  }
+
+  const bool completed = factorizer.schedule.empty ();
+
+  factorizer.erase ();
+  reset_noccs ();
+  reset_occs ();
+
+  if (completed)
+    last.bva.added = stats.added.irredundant;
+
+  const int64_t introduced = stats.bva.vars - vars;
+  PHASE ("bva", stats.bva.count,
+         "%s introduced %" PRId64 " variables removing %" PRId64
+         " and adding %" PRId64 " clauses",
+         completed ? "completed and" : "incomplete but", introduced,
+         stats.bva.removed - removed, stats.bva.added - added);
+
+  report ('x', !opts.reportall && !introduced);
+
+  STOP_SIMPLIFIER (bva, BVA);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Move the introduced external variable 'from' to 'to' in the proof (see
+// 'External::rename_introduced').  This first adds the definitions
+// '(to | -from)' and '(-to | from)', which are blocked on 'to', derives all
+// clauses containing 'from' with 'from' replaced by 'to' and deletes the
+// old clauses.  Here 'idx' is the internal variable if it is still mapped
+// to 'to', as otherwise only the units on the external variable remain.
+// Since bounded variable addition is disabled with LRAT, the clauses on the
+// extension stack are not part of the proof and need no renaming here.
+
+void Internal::rename_introduced_in_proof (int from, int to, int idx) {
+
+  assert (proof);
+  LOG ("renaming external variable %d to %d in proof", from, to);
+
+  const uint64_t positive = ++clause_id; // (to | -from)
+  const uint64_t negative = ++clause_id; // (-to | from)
+  vector<int> elits{to, -from};
+  proof->add_external_derived_clause (positive, false, elits, lrat_chain);
+  elits = {-to, from};
+  proof->add_external_derived_clause (negative, false, elits, lrat_chain);
+
+  // Derive the renamed clause 'elits' from the old clause 'id' and return
+  // the identifier of the renamed clause.
+  //
+  vector<int> old;
+  const auto derive = [&] (uint64_t id, bool redundant,
+                           const vector<int> &elits) {
+    old.clear ();
+    for (const auto &elit : elits)
+      if (elit == to)
+        old.push_back (from);
+      else if (elit == -to)
+        old.push_back (-from);
+      else
+        old.push_back (elit);
+    const uint64_t renamed = ++clause_id;
+    proof->add_external_derived_clause (renamed, redundant, elits,
+                                        lrat_chain);
+    proof->delete_external_clause (id, redundant, old);
+    return renamed;
+  };
+
+  if (idx) {
+    for (const auto &c : clauses) {
+      if (c->garbage && c->size != 2) // Binary deletion is delayed.
+        continue;
+      bool contains = false;
+      for (const auto &lit : *c)
+        if (vidx (lit) == idx) {
+          contains = true;
+          break;
+        }
+      if (!contains)
+        continue;
+      elits.clear ();
+      for (const auto &lit : *c)
+        elits.push_back (externalize (lit));
+      c->id = derive (c->id, c->redundant, elits);
+    }
+  }
+
+  // The same unit might be stored both internally and externally.
+  //
+  uint64_t units[2] = {0, 0}, renamed_units[2] = {0, 0};
+  for (int sign = -1; sign <= 1; sign += 2) {
+    const int s = sign < 0;
+    if (idx) {
+      uint64_t &id = unit_clauses[vlit (sign * idx)];
+      if (id) {
+        elits = {sign * to};
+        units[s] = id;
+        id = renamed_units[s] = derive (id, false, elits);
+      }
+    }
+    uint64_t &id = external->ext_units[2 * to + s];
+    if (!id)
+      continue;
+    if (id == units[s])
+      id = renamed_units[s];
+    else {
+      elits = {sign * to};
+      id = derive (id, false, elits);
+    }
+  }
+
+  elits = {to, -from};
+  proof->delete_external_clause (positive, false, elits);
+  elits = {-to, from};
+  proof->delete_external_clause (negative, false, elits);
+}
+
+} // namespace CaDiCaL
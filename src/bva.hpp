@@ -0,0 +1,53 @@
+#ifndef _bva_hpp_INCLUDED
+#define _bva_hpp_INCLUDED
+
+#include "heap.hpp" // Alphabetically after 'bva.hpp'.
+
+namespace CaDiCaL {
+
+struct Clause;
+struct Internal;
+
+struct bva_fewer_occs {
+  Internal *internal;
+  bva_fewer_occs (Internal *i) : internal (i) {}
+  bool operator() (unsigned a, unsigned b);
+};
+
+typedef heap<bva_fewer_occs> BVASchedule;
+
+class Factorizer {
+
+  friend struct Internal;
+
+  // A match is a set of literals 'lits' and a set of clauses, where the
+  // clause obtained by replacing the first literal with any other of the
+  // literals exists too.  These clauses are stored in 'rows', one row of
+  // 'lits.size ()' clauses per matched clause.
+
+  struct Candidate {
+    int lit;        // literal replacing the first matched literal
+    unsigned row;   // of the matched clause
+    Clause *clause; // matched clause with the first literal replaced
+  };
+
+  vector<int> lits;
+  vector<Clause *> rows, next;
+  vector<Candidate> candidates;
+  BVASchedule schedule;
+  int64_t limit; // on 'stats.ticks.bva'
+
+  Factorizer (Internal *i) : schedule (bva_fewer_occs (i)), limit (0) {}
+
+  void erase () {
+    erase_vector (lits);
+    erase_vector (rows);
+    erase_vector (next);
+    erase_vector (candidates);
+    schedule.erase ();
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
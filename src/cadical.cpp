@@ -5,6 +5,11 @@
 #include "internal.hpp"
 #include "signal.hpp" // Separate, only need for apps.
 
+#ifndef NTHREADS
+#include <atomic>
+#include <thread>
+#endif
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -19,6 +24,150 @@ namespace CaDiCaL {
 // multiple instances of the solver use the 'Solver' interface directly
 // which is thread-safe and reentrant among different solver instances.
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+/*------------------------------------------------------------------------*/
+
+// In portfolio mode ('--threads=<n>') the parsed formula is copied to
+// 'n - 1' differently configured solvers and all 'n' solvers run in their
+// own thread.  The first solver thread which determines satisfiability
+// wins and all others are terminated.  Short learned clauses are exported
+// by each solver through the 'Learner' interface into its own 'Exchange'
+// buffer and imported by all other solvers through the 'Importer'
+// interface during restarts.
+
+// The exchange buffer is a ring buffer with one writer (the thread of the
+// solver exporting clauses) and many readers (all other solver threads).
+// It does not need locks.  The writer marks a slot as being written by
+// an odd stamp and as complete by the even stamp derived from the position
+// of the clause in the sequence of all exported clauses.  Readers only
+// accept a clause if they read the same expected stamp before and after
+// copying the clause, and otherwise just skip it.  Readers which fall
+// behind by more than the capacity of the buffer skip clauses too.
+
+struct Exchange {
+
+  static const int max_size = 8;             // largest shared clause
+  static const uint64_t capacity = 1u << 12; // power of two
+
+  struct Slot {
+    std::atomic<uint64_t> stamp;
+    std::atomic<int> size;
+    std::atomic<int> lits[max_size];
+  };
+
+  Slot slots[capacity];
+  std::atomic<uint64_t> head; // number of exported clauses
+
+  Exchange () : head (0) {
+    for (auto &slot : slots)
+      slot.stamp.store (0, std::memory_order_relaxed);
+  }
+
+  void publish (const vector<int> &clause) {
+    assert (clause.size () <= (size_t) max_size);
+    const uint64_t pos = head.load (std::memory_order_relaxed);
+    Slot &slot = slots[pos & (capacity - 1)];
+    slot.stamp.store (2 * pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+    slot.size.store ((int) clause.size (), std::memory_order_relaxed);
+    for (size_t i = 0; i < clause.size (); i++)
+      slot.lits[i].store (clause[i], std::memory_order_relaxed);
+    slot.stamp.store (2 * pos + 2, std::memory_order_release);
+    head.store (pos + 1, std::memory_order_release);
+  }
+
+  bool read (uint64_t pos, vector<int> &clause) {
+    const Slot &slot = slots[pos & (capacity - 1)];
+    const uint64_t stamp = 2 * pos + 2;
+    if (slot.stamp.load (std::memory_order_acquire) != stamp)
+      return false;
+    clause.clear ();
+    const int size = slot.size.load (std::memory_order_relaxed);
+    if (size < 1 || size > max_size)
+      return false;
+    for (int i = 0; i < size; i++)
+      clause.push_back (slot.lits[i].load (std::memory_order_relaxed));
+    std::atomic_thread_fence (std::memory_order_acquire);
+    return slot.stamp.load (std::memory_order_relaxed) == stamp;
+  }
+};
+
+struct Worker;
+
+struct Portfolio {
+  vector<Worker *> workers;
+  std::atomic<int> winner;      // index of first successful worker
+  const volatile bool *timesup; // see 'App::timesup'
+  Portfolio (const volatile bool *t) : winner (-1), timesup (t) {}
+};
+
+struct Worker : public Terminator, public Learner, public Importer {
+
+  Portfolio &portfolio;
+  Solver *solver;
+  int id, res;
+
+  Exchange exchange;     // clauses exported by this solver
+  vector<int> exported;  // clause currently exported
+  vector<int> imported;  // clause currently imported
+  size_t next;           // next literal in 'imported'
+  vector<uint64_t> read; // next position in the exchange of others
+  std::thread thread;
+
+  Worker (Portfolio &p, Solver *s, int i)
+      : portfolio (p), solver (s), id (i), res (0), next (0) {}
+
+  bool terminate () {
+    return *portfolio.timesup || portfolio.winner.load () >= 0;
+  }
+
+  bool learning (int size) {
+    return 0 < size && size <= Exchange::max_size;
+  }
+
+  void learn (int lit) {
+    if (lit)
+      exported.push_back (lit);
+    else
+      exchange.publish (exported), exported.clear ();
+  }
+
+  bool importing () {
+    const int size = portfolio.workers.size ();
+    read.resize (size, 0);
+    for (int i = 1; i < size; i++) {
+      const int other = (id + i) % size;
+      Exchange &from = portfolio.workers[other]->exchange;
+      const uint64_t head = from.head.load (std::memory_order_acquire);
+      uint64_t &pos = read[other];
+      if (head - pos > Exchange::capacity)
+        pos = head - Exchange::capacity;
+      while (pos < head)
+        if (from.read (pos++, imported)) {
+          imported.push_back (0);
+          next = 0;
+          return true;
+        }
+    }
+    return false;
+  }
+
+  int import () {
+    assert (next < imported.size ());
+    return imported[next++];
+  }
+
+  void run () {
+    res = solver->solve ();
+    int expected = -1;
+    if (res)
+      portfolio.winner.compare_exchange_strong (expected, id);
+  }
+};
+
+/*------------------------------------------------------------------------*/
+#endif
 /*------------------------------------------------------------------------*/
 
 class App : public Handler, public Terminator {
@@ -31,6 +180,12 @@ class App : public Handler, public Terminator {
   int time_limit; // '-t <sec>'
 #endif
 
+#ifndef NTHREADS
+  int threads; // '--threads=<n>'
+  int solve_portfolio (int conflict_limit, int decision_limit,
+                       int preprocessing, int localsearch);
+#endif
+
   // Strictness of (DIMACS) parsing:
   //
   //  0 = force parsing and completely ignore header
@@ -127,6 +282,9 @@ void App::print_usage (bool all) {
 #endif
 #ifndef __WIN32
         "  -t <sec>       set wall clock time limit\n"
+#endif
+#ifndef NTHREADS
+        "  --threads=<n>  run portfolio of '<n>' solvers sharing clauses\n"
 #endif
         "\n"
         "Or '<option>' is one of the less common options\n"
@@ -543,8 +701,18 @@ int App::main (int argc, char **argv) {
       if (localsearch < 0)
         APPERR ("invalid argument in '%s' (expected non-negative number)",
                 argv[i]);
-    } else if (has_prefix (argv[i], "--") &&
-               solver->is_valid_configuration (argv[i] + 2)) {
+    }
+#ifndef NTHREADS
+    else if (has_prefix (argv[i], "--threads=")) {
+      if (!parse_int_str (argv[i] + 10, threads))
+        APPERR ("invalid option '%s'", argv[i]);
+      if (threads < 1)
+        APPERR ("invalid argument in '%s' (expected positive number)",
+                argv[i]);
+    }
+#endif
+    else if (has_prefix (argv[i], "--") &&
+             solver->is_valid_configuration (argv[i] + 2)) {
       solver->configure (argv[i] + 2);
     } else if (set (argv[i])) {
       /* nothing do be done */
@@ -835,7 +1003,20 @@ int App::main (int argc, char **argv) {
 
     if (inconclusive && res == 20)
       res = 0;
-  } else {
+  }
+#ifndef NTHREADS
+  else if (threads > 1 && proof_specified) {
+    solver->section ("solving");
+    solver->message ("ignoring '--threads=%d' since tracing proof",
+                     threads);
+    res = solver->solve ();
+  } else if (threads > 1) {
+    solver->section ("portfolio solving");
+    res = solve_portfolio (conflict_limit, decision_limit, preprocessing,
+                           localsearch);
+  }
+#endif
+  else {
     solver->section ("solving");
     res = solver->solve ();
   }
@@ -902,6 +1083,92 @@ int App::main (int argc, char **argv) {
   return res;
 }
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+/*------------------------------------------------------------------------*/
+
+// The copies of the formula are diversified by using different random
+// seeds, shuffling and the predefined configurations.  The copies can not
+// be configured through the API anymore after copying the formula (which
+// also copies the options), thus we set the internal options directly.
+
+static void diversify (Options &opts, int i) {
+  opts.seed += i;
+  opts.shuffle = opts.shufflerandom = (i & 1);
+  if (i % 3 == 1)
+    Config::set (opts, "sat");
+  else if (i % 3 == 2)
+    Config::set (opts, "unsat");
+}
+
+int App::solve_portfolio (int conflict_limit, int decision_limit,
+                          int preprocessing, int localsearch) {
+
+  // Variable instantiation removes literals from clauses without the
+  // reduced clauses being implied by the formula.  Then learned clauses
+  // of this solver might not be implied by the original formula either and
+  // thus can not be shared with (and imported by) other solvers.
+  //
+  solver->internal->opts.instantiate = 0;
+
+  Portfolio portfolio (&timesup);
+  for (int i = 0; i < threads; i++) {
+    Solver *other = solver;
+    if (i) {
+      other = new Solver ();
+      solver->copy (*other);
+      diversify (other->internal->opts, i);
+      other->set ("quiet", 1);
+      if (preprocessing > 0)
+        other->limit ("preprocessing", preprocessing);
+      if (localsearch > 0)
+        other->limit ("localsearch", localsearch);
+      if (conflict_limit >= 0)
+        other->limit ("conflicts", conflict_limit);
+      if (decision_limit >= 0)
+        other->limit ("decisions", decision_limit);
+    }
+    Worker *worker = new Worker (portfolio, other, i);
+    other->connect_terminator (worker);
+    other->connect_learner (worker);
+    other->connect_importer (worker);
+    portfolio.workers.push_back (worker);
+  }
+  solver->message ("running %d solvers in parallel threads", threads);
+  for (auto worker : portfolio.workers)
+    worker->thread = std::thread (&Worker::run, worker);
+  for (auto worker : portfolio.workers)
+    worker->thread.join ();
+
+  int res = 0;
+  const int winner = portfolio.winner.load ();
+  if (winner >= 0) {
+    Worker *worker = portfolio.workers[winner];
+    res = worker->res;
+    solver->message ("solver %d determined result %d first", winner, res);
+    if (winner) {
+      const bool quiet = get ("quiet");
+      std::swap (portfolio.workers[0]->solver, worker->solver);
+      solver = portfolio.workers[0]->solver;
+      set ("quiet", quiet);
+    }
+  } else
+    solver->message ("no solver determined a result");
+
+  for (auto worker : portfolio.workers) {
+    Solver *other = worker->solver;
+    other->disconnect_terminator ();
+    other->disconnect_learner ();
+    other->disconnect_importer ();
+    if (other != solver)
+      delete other;
+    delete worker;
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+#endif
 /*------------------------------------------------------------------------*/
 
 // The real initialization is delayed.
@@ -912,6 +1179,9 @@ void App::init () {
 
 #ifndef __WIN32
   time_limit = -1;
+#endif
+#ifndef NTHREADS
+  threads = 1;
 #endif
   force_strict_parsing = 1;
   force_writing = false;
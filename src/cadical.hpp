@@ -15,6 +15,11 @@ namespace CaDiCaL {
 // and 'END IPASIR' comments below.  The following '[Example]' below might
 // also be a good starting point to understand the API.
 
+// Unless compiled with '-DNTHREADS' (see '--no-threads' of 'configure') the
+// library might start threads, but only if options such as 'walkthreads'
+// enabling them are set (they are all disabled by default).  Programs
+// linked against the library thus need '-pthread' as linker flag.
+
 /*========================================================================*/
 
 // [Example]
@@ -193,6 +198,7 @@ struct External;
 // Forward declaration of call-back classes. See bottom of this file.
 
 class Learner;
+class Importer;
 class Terminator;
 class ClauseIterator;
 class WitnessIterator;
@@ -404,6 +410,21 @@ public:
 
   // ====== END IPASIR-UP ==================================================
 
+  //------------------------------------------------------------------------
+  // Importing clauses is not part of IPASIR.  A connected importer (see
+  // 'Importer' below) is asked for new clauses at restarts, for instance
+  // for clauses learned by other solvers working on the same formula, as
+  // in the portfolio mode '--threads' of the stand-alone solver.  Imported
+  // clauses are required to be implied by the formula.  As they can not be
+  // justified, nothing is imported while proofs are traced.  While API
+  // calls are traced imported clauses are written as 'import' lines.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_importer (Importer *importer);
+  void disconnect_importer ();
+
   //------------------------------------------------------------------------
   // Adds a literal to the constraint clause. Same functionality as 'add'
   // but the clause only exists for the next call to solve (same lifetime as
@@ -604,18 +625,28 @@ public:
   void optimize (int val);
 
   // Specify search limits, where currently 'name' can be "conflicts",
-  // "decisions", "preprocessing", or "localsearch".  The first two limits
-  // are unbounded by default.  Thus using a negative limit for conflicts or
-  // decisions switches back to the default of unlimited search (for that
-  // particular limit).  The preprocessing limit determines the number of
-  // preprocessing rounds, which is zero by default.  Similarly, the local
-  // search limit determines the number of local search rounds (also zero by
-  // default).  As with 'set', the return value denotes whether the limit
-  // 'name' is valid.  These limits are only valid for the next 'solve' or
-  // 'simplify' call and reset to their default after 'solve' returns (as
-  // well as overwritten and reset during calls to 'simplify' and
-  // 'lookahead').  We actually also have an internal "terminate" limit
-  // which however should only be used for testing and debugging.
+  // "decisions", "ticks", "preprocessing", or "localsearch".  The first
+  // three limits are unbounded by default.  Thus using a negative limit for
+  // conflicts, decisions or ticks switches back to the default of unlimited
+  // search (for that particular limit).  Ticks measure the effort of search
+  // and inprocessing in terms of accessed cache lines, which gives a
+  // deterministic budget correlating well with running time.  The limit is
+  // checked between search steps and thus inprocessing might exceed it
+  // slightly.  If 'solve' returns '0' because the ticks limit is hit, the
+  // next 'solve' call resumes the search with the same restart, rephase and
+  // stabilization state (learned clauses, scores and phases are kept
+  // anyhow), which makes solving in time slices cheap.  This also holds if
+  // clauses or assumptions are added in between.  Hitting the conflict or
+  // decision limit does not resume and the next search starts over.  The
+  // preprocessing limit determines the number of preprocessing rounds,
+  // which is zero by default.  Similarly, the local search limit determines
+  // the number of local search rounds (also zero by default).  As with
+  // 'set', the return value denotes whether the limit 'name' is valid.
+  // These limits are only valid for the next 'solve' or 'simplify' call and
+  // reset to their default after 'solve' returns (as well as overwritten
+  // and reset during calls to 'simplify' and 'lookahead').  We actually
+  // also have an internal "terminate" limit which however should only be
+  // used for testing and debugging.
   //
   //   require (READY)
   //   ensure (READY)
@@ -945,8 +976,9 @@ private:
   //
   // Alternatively one case use 'trace_api_calls'.  Both
   //
-  bool close_trace_api_file; // Close file if owned by solver it.
-  FILE *trace_api_file;      // Also acts as flag that we are tracing.
+  bool close_trace_api_file;  // Close file if owned by solver it.
+  FILE *trace_api_file;       // Also acts as flag that we are tracing.
+  Importer *tracing_importer; // Traces imported clauses ('import' lines).
 
   static bool tracing_api_through_environment;
 
@@ -1086,6 +1118,19 @@ public:
   virtual void learn (int lit) = 0;
 };
 
+// Connected importers are asked for new clauses at restarts.  As long
+// 'importing' returns true the solver backtracks to the root level and
+// then obtains the literals of the next clause through 'import' one by one
+// terminated by a zero literal.  Clauses with variables which are not
+// active anymore in the solver (eliminated or substituted) are ignored.
+
+class Importer {
+public:
+  virtual ~Importer () {}
+  virtual bool importing () = 0;
+  virtual int import () = 0;
+};
+
 /*------------------------------------------------------------------------*/
 
 // Allows to connect an external propagator to propagate values to variables
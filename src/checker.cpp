@@ -233,6 +233,7 @@ void Checker::enlarge_vars (int64_t idx) {
 
   watchers.resize (2 * new_size_vars);
   marks.resize (2 * new_size_vars);
+  used.resize (new_size_vars);
 
   assert (idx < new_size_vars);
   size_vars = new_size_vars;
@@ -454,6 +455,49 @@ bool Checker::check () {
   return res;
 }
 
+// Derived clauses which are not implied are still accepted if they are
+// blocked on their first literal and the variable of this literal is fresh,
+// i.e., it never occurred in an original clause nor in a derived clause
+// other than as first literal.  This only holds for the variables
+// introduced in 'bva.cpp' whose definitions are added this way.  Root level
+// satisfied clauses are skipped and the pivot has to be unassigned, since
+// units are only kept as root level assignment.
+
+bool Checker::check_blocked () {
+  if (unsimplified.empty ())
+    return false;
+  const int pivot = unsimplified[0];
+  if (used[abs (pivot)] || val (pivot))
+    return false;
+  for (const auto &lit : unsimplified)
+    mark (lit) = true;
+  bool res = !mark (-pivot);
+  for (uint64_t i = 0; res && i < size_clauses; i++)
+    for (CheckerClause *c = clauses[i]; res && c; c = c->next) {
+      if (!c->size || clause_satisfied (c))
+        continue;
+      bool resolvable = false, tautological = false;
+      for (unsigned j = 0; j < c->size; j++) {
+        const int lit = c->literals[j];
+        if (lit == -pivot)
+          resolvable = true;
+        else if (mark (-lit))
+          tautological = true;
+      }
+      if (resolvable && !tautological)
+        res = false;
+    }
+  for (const auto &lit : unsimplified)
+    mark (lit) = false;
+  return res;
+}
+
+void Checker::mark_used (int pivot) {
+  for (const auto &lit : unsimplified)
+    if (lit != pivot)
+      used[abs (lit)] = true;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Checker::add_clause (const char *type) {
@@ -502,6 +546,7 @@ void Checker::add_original_clause (uint64_t id, bool, const vector<int> &c,
   stats.added++;
   stats.original++;
   import_clause (c);
+  mark_used (0);
   last_id = id;
   if (tautological ())
     LOG ("CHECKER ignoring satisfied original clause");
@@ -522,17 +567,19 @@ void Checker::add_derived_clause (uint64_t id, bool, const vector<int> &c,
   stats.derived++;
   import_clause (c);
   last_id = id;
+  mark_used (unsimplified.empty () ? 0 : unsimplified[0]);
   if (tautological ())
     LOG ("CHECKER ignoring satisfied derived clause");
-  else if (!check ()) {
+  else if (check () || check_blocked ())
+    add_clause ("derived");
+  else {
     fatal_message_start ();
     fputs ("failed to check derived clause:\n", stderr);
     for (const auto &lit : unsimplified)
       fprintf (stderr, "%d ", lit);
     fputc ('0', stderr);
     fatal_message_end ();
-  } else
-    add_clause ("derived");
+  }
   simplified.clear ();
   unsimplified.clear ();
   STOP (checking);
@@ -65,6 +65,7 @@ class Checker : public StatTracer {
   static unsigned l2u (int lit);
   vector<CheckerWatcher> watchers; // watchers of literals
   vector<signed char> marks;       // mark bits of literals
+  vector<bool> used; // variable occurred outside of blocked definitions
 
   signed char &mark (int lit);
   CheckerWatcher &watcher (int lit);
@@ -120,6 +121,8 @@ class Checker : public StatTracer {
   bool propagate ();         // propagate and check for conflicts
   void backtrack (unsigned); // prepare for next clause
   bool check ();             // check simplified clause is implied
+  bool check_blocked ();     // check definition of fresh variable
+  void mark_used (int pivot); // mark variables except 'pivot' as used
 
   struct {
 
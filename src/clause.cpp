@@ -93,7 +93,15 @@ Clause *Internal::new_clause (bool red, int glue) {
     keep = false;
 
   size_t bytes = Clause::bytes (size);
-  Clause *c = (Clause *) new char[bytes];
+#ifdef COMPACT_WATCHES
+  Clause *c = (Clause *) arena.allocate (bytes);
+#else
+  Clause *c;
+  if (opts.arena && opts.arenanew)
+    c = (Clause *) arena.allocate (bytes);
+  else
+    c = (Clause *) new char[bytes];
+#endif
 
   stats.added.total++;
   c->id = ++clause_id;
@@ -222,15 +230,25 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
 }
 
 // This is the 'raw' deallocation of a clause.  If the clause is in the
-// arena nothing happens.  If the clause is not in the arena its memory is
-// reclaimed immediately.
+// arena nothing happens.  If the clause was allocated in the blocks of new
+// clauses of the arena ('opts.arenanew') its memory is put on a free list
+// and otherwise reclaimed immediately.  With compact watches all clauses
+// are in the arena.
 
 void Internal::deallocate_clause (Clause *c) {
   char *p = (char *) c;
+#ifdef COMPACT_WATCHES
+  (void) p;
+  return;
+#else
   if (arena.contains (p))
     return;
   LOG (c, "deallocate pointer %p", (void *) c);
-  delete[] p;
+  if (arena.allocated (p))
+    arena.release (p, c->bytes ());
+  else
+    delete[] p;
+#endif
 }
 
 void Internal::delete_clause (Clause *c) {
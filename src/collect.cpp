@@ -119,11 +119,10 @@ void Internal::protect_reasons () {
     count++;
 #endif
   }
-  int l = 0;
-  for (auto &t : trails) {
-    l++;
+  for (int l = 1; l <= trails.size (); l++) {
     assert (l <= level);
-    for (auto &lit : t) {
+    for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+      const int lit = *p;
       if (!active (lit))
         continue;
       assert (val (lit));
@@ -180,11 +179,10 @@ void Internal::unprotect_reasons () {
     count++;
 #endif
   }
-  int l = 0;
-  for (auto &t : trails) {
-    l++;
+  for (int l = 1; l <= trails.size (); l++) {
     assert (l <= level);
-    for (auto &lit : t) {
+    for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+      const int lit = *p;
       if (!active (lit))
         continue;
       assert (val (lit));
@@ -244,34 +242,35 @@ size_t Internal::flush_occs (int lit) {
 // hidden in 'Clause.collect', which for the root level context of
 // preprocessing is actually redundant.
 
-inline void Internal::flush_watches (int lit, Watches &saved) {
-  assert (saved.empty ());
-  Watches &ws = watches (lit);
-  const const_watch_iterator end = ws.end ();
-  watch_iterator j = ws.begin ();
-  const_watch_iterator i;
-  for (i = j; i != end; i++) {
-    Watch w = *i;
-    Clause *c = w.clause;
-    if (c->collect ())
-      continue;
-    if (c->moved)
-      c = w.clause = c->copy;
-    w.size = c->size;
-    const int new_blit_pos = (c->literals[0] == lit);
-    LOG (c, "clause in flush_watch starting from %d", lit);
-    assert (c->literals[!new_blit_pos] == lit); /*FW1*/
-    w.blit = c->literals[new_blit_pos];
-    if (w.binary ())
-      *j++ = w;
-    else
-      saved.push_back (w);
+// Watches of clauses which were shrunken to binary clauses (by removing
+// root-level falsified literals) are moved to the binary watches.
+
+inline void Internal::flush_watches (int lit) {
+  Watches &bws = bwatches (lit);
+  for (int binary = 1; binary >= 0; binary--) {
+    Watches &ws = binary ? bws : watches (lit);
+    const const_watch_iterator end = ws.end ();
+    watch_iterator j = ws.begin ();
+    const_watch_iterator i;
+    for (i = j; i != end; i++) {
+      Clause *c = watched (*i);
+      if (c->collect ())
+        continue;
+      if (c->moved)
+        c = c->copy;
+      const int new_blit_pos = (c->literals[0] == lit);
+      LOG (c, "clause in flush_watch starting from %d", lit);
+      assert (c->literals[!new_blit_pos] == lit); /*FW1*/
+      const Watch w = make_watch (c->literals[new_blit_pos], c);
+      assert (binary || !i->binary ());
+      if (w.binary () && !binary)
+        bws.push_back (w);
+      else
+        *j++ = w;
+    }
+    ws.resize (j - ws.begin ());
+    shrink_vector (ws);
   }
-  ws.resize (j - ws.begin ());
-  for (const auto &w : saved)
-    ws.push_back (w);
-  saved.clear ();
-  shrink_vector (ws);
 }
 
 void Internal::flush_all_occs_and_watches () {
@@ -279,11 +278,9 @@ void Internal::flush_all_occs_and_watches () {
     for (auto idx : vars)
       flush_occs (idx), flush_occs (-idx);
 
-  if (watching ()) {
-    Watches tmp;
+  if (watching ())
     for (auto idx : vars)
-      flush_watches (idx, tmp), flush_watches (-idx, tmp);
-  }
+      flush_watches (idx), flush_watches (-idx);
 }
 
 /*------------------------------------------------------------------------*/
@@ -311,11 +308,10 @@ void Internal::update_reason_references () {
     count++;
 #endif
   }
-  int l = 0;
-  for (auto &t : trails) {
-    l++;
+  for (int l = 1; l <= trails.size (); l++) {
     assert (l <= level);
-    for (auto &lit : t) {
+    for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+      const int lit = *p;
       if (!active (lit))
         continue;
       Var &v = var (lit);
@@ -394,6 +390,17 @@ void Internal::copy_clause (Clause *c) {
        (void *) c->copy);
 }
 
+// Copy the clauses watched by 'lit' starting with the binary clauses.
+
+inline void Internal::copy_watched_clauses (int lit) {
+  for (const auto &w : bwatches (lit))
+    if (!watched (w)->moved && !watched (w)->collect ())
+      copy_clause (watched (w));
+  for (const auto &w : watches (lit))
+    if (!watched (w)->moved && !watched (w)->collect ())
+      copy_clause (watched (w));
+}
+
 // This is the moving garbage collector.
 
 void Internal::copy_non_garbage_clauses () {
@@ -453,9 +460,7 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (auto idx : vars)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        copy_watched_clauses (sign * likely_phase (idx));
 
   } else {
 
@@ -469,9 +474,7 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (int idx = queue.last; idx; idx = link (idx).prev)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        copy_watched_clauses (sign * likely_phase (idx));
   }
 
   // Do not forget to move clauses which are not watched, which happened in
@@ -543,7 +546,13 @@ void Internal::check_clause_stats () {
 
 /*------------------------------------------------------------------------*/
 
-bool Internal::arenaing () { return opts.arena && (stats.collections > 1); }
+bool Internal::arenaing () {
+#ifdef COMPACT_WATCHES
+  return true; // Clauses can only be reclaimed by moving them.
+#else
+  return opts.arena && (stats.collections > 1);
+#endif
+}
 
 void Internal::garbage_collection () {
   if (unsat)
@@ -551,6 +560,7 @@ void Internal::garbage_collection () {
   START (collect);
   report ('G', 1);
   stats.collections++;
+  saved_trail.clear (); // Saved reasons might be deleted.
   mark_satisfied_clauses_as_garbage ();
   if (!protected_reasons)
     protect_reasons ();
@@ -565,4 +575,81 @@ void Internal::garbage_collection () {
   STOP (collect);
 }
 
+/*------------------------------------------------------------------------*/
+
+// Selective non-moving garbage collection ('opts.selective').  The moving
+// garbage collector copies all surviving clauses and flushes all watch
+// lists.  In most reductions we instead only delete garbage clauses without
+// moving any clause and only flush the watch lists of the literals which
+// watch a collected clause.  This still needs one pass over all clauses and
+// the reduce policy is the same, but most watch lists are left untouched.
+// The memory of deleted clauses allocated in arena blocks (see
+// 'opts.arenanew' in 'arena.hpp') is reused for new clauses immediately,
+// while garbage clauses in the 'from' space of the arena are only reclaimed
+// by the next full collection, which also compacts the arena.  Full
+// collections happen every 'opts.selectiveint' reductions and are also
+// required if there are new root level units, since then all clauses need
+// to be checked for satisfied clauses and falsified literals.
+
+bool Internal::selective_collecting () {
+  if (!opts.selective)
+    return false;
+  if (!watching () || occurring ())
+    return false;
+  if (last.collect.fixed < stats.all.fixed)
+    return false;
+  return stats.reductions % opts.selectiveint;
+}
+
+void Internal::selective_collection () {
+  if (unsat)
+    return;
+  START (selective);
+  stats.selective++;
+  saved_trail.clear (); // Saved reasons might be deleted.
+  assert (protected_reasons);
+
+  // First mark and flush the watch lists of all watched literals of
+  // collected clauses.  Clauses are not moved and thus 'literals[0]' and
+  // 'literals[1]' are the watched literals.
+  //
+  vector<int> flush;
+  for (const auto &c : clauses) {
+    if (!c->collect ())
+      continue;
+    for (int k = 0; k < 2; k++) {
+      const int lit = c->literals[k];
+      if (marked2 (lit))
+        continue;
+      mark2 (lit);
+      flush.push_back (lit);
+    }
+  }
+  for (const auto lit : flush)
+    flush_watches (lit);
+  for (const auto lit : flush)
+    unmark (lit);
+
+  PHASE ("selective", stats.selective, "flushed %zd watch lists %.0f%%",
+         flush.size (), percent (flush.size (), 2 * active ()));
+  erase_vector (flush);
+
+  // Then delete the collected clauses without moving the others.
+  //
+  const auto end = clauses.end ();
+  auto j = clauses.begin (), i = j;
+  while (i != end) {
+    Clause *c = *j++ = *i++;
+    if (!c->collect ())
+      continue;
+    delete_clause (c);
+    j--;
+  }
+  clauses.resize (j - clauses.begin ());
+
+  check_clause_stats ();
+  unprotect_reasons ();
+  STOP (selective);
+}
+
 } // namespace CaDiCaL
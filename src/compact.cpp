@@ -177,6 +177,12 @@ void Internal::compact () {
   assert (control.size () == 1);
   assert (propagated == trail.size ());
 
+  // Background walkers work on variable indices of their snapshot and
+  // thus are restarted after compacting.
+  //
+  const bool walking = walkers;
+  stop_walkers ();
+
   garbage_collection ();
 
   Mapper mapper (this);
@@ -281,9 +287,12 @@ void Internal::compact () {
   // Map the blocking literals in all watches.
   //
   if (!wtab.empty ())
-    for (auto lit : lits)
+    for (auto lit : lits) {
       for (auto &w : watches (lit))
         w.blit = mapper.map_lit (w.blit);
+      for (auto &w : bwatches (lit))
+        w.blit = mapper.map_lit (w.blit);
+    }
 
   // We first flush inactive variables and map the links in the queue.  This
   // has to be done before we map the actual links data structure 'links'.
@@ -343,7 +352,9 @@ void Internal::compact () {
   // Now we continue in reverse order of allocated bytes, e.g., see
   // 'Internal::enlarge' which reallocates in order of allocated bytes.
 
+#ifndef HOT_VARS
   mapper.map_vector (ftab);
+#endif
   mapper.map_vector (parents);
   mapper.map_vector (marks);
   mapper.map_vector (phases.saved);
@@ -386,6 +397,44 @@ void Internal::compact () {
 
   /*----------------------------------------------------------------------*/
 
+  // Special case for 'val' as for 'val' we trade branch less code for
+  // memory and always allocated an [-maxvar,...,maxvar] array.
+  {
+    signed char *new_vals = new signed char[2 * mapper.new_vsize];
+    ignore_clang_analyze_memory_leak_warning = new_vals;
+    new_vals += mapper.new_vsize;
+    for (auto src : vars)
+      new_vals[-mapper.map_idx (src)] = vals[-src];
+    for (auto src : vars)
+      new_vals[mapper.map_idx (src)] = vals[src];
+    new_vals[0] = 0;
+    vals -= vsize;
+    delete[] vals;
+    vals = new_vals;
+  }
+
+  mapper.map_vector (i2e);
+  mapper.map2_vector (ptab);
+  mapper.map_vector (btab);
+  mapper.map_vector (gtab);
+  mapper.map_vector (links);
+  mapper.map_vector (vtab);
+  if (!ntab.empty ())
+    mapper.map2_vector (ntab);
+  if (!wtab.empty ())
+    mapper.map2_vector (wtab);
+  if (!bwtab.empty ())
+    mapper.map2_vector (bwtab);
+  if (!otab.empty ())
+    mapper.map2_vector (otab);
+  if (!big.empty ())
+    mapper.map2_vector (big);
+
+  /*----------------------------------------------------------------------*/
+
+  // Re-assuming and re-adding the constraint use 'val', 'flags' and 'var'
+  // (the latter for 'assume'), so this code has to be after remapping them.
+
   if (!external->assumptions.empty ()) {
 
     for (const auto &elit : external->assumptions) {
@@ -404,23 +453,6 @@ void Internal::compact () {
            external->assumptions.size ());
   }
 
-  // Special case for 'val' as for 'val' we trade branch less code for
-  // memory and always allocated an [-maxvar,...,maxvar] array.
-  {
-    signed char *new_vals = new signed char[2 * mapper.new_vsize];
-    ignore_clang_analyze_memory_leak_warning = new_vals;
-    new_vals += mapper.new_vsize;
-    for (auto src : vars)
-      new_vals[-mapper.map_idx (src)] = vals[-src];
-    for (auto src : vars)
-      new_vals[mapper.map_idx (src)] = vals[src];
-    new_vals[0] = 0;
-    vals -= vsize;
-    delete[] vals;
-    vals = new_vals;
-  }
-
-  // 'constrain' uses 'val', so this code has to be after remapping that
   if (is_constraint) {
     assert (!level);
     assert (!external->constraint.back ());
@@ -441,21 +473,6 @@ void Internal::compact () {
            external->constraint.size () - 1);
   }
 
-  mapper.map_vector (i2e);
-  mapper.map2_vector (ptab);
-  mapper.map_vector (btab);
-  mapper.map_vector (gtab);
-  mapper.map_vector (links);
-  mapper.map_vector (vtab);
-  if (!ntab.empty ())
-    mapper.map2_vector (ntab);
-  if (!wtab.empty ())
-    mapper.map2_vector (wtab);
-  if (!otab.empty ())
-    mapper.map2_vector (otab);
-  if (!big.empty ())
-    mapper.map2_vector (big);
-
   /*======================================================================*/
   // In the fourth part we map the binary heap for scores.
   /*======================================================================*/
@@ -538,6 +555,9 @@ void Internal::compact () {
          "new compact limit %" PRId64 " after %" PRId64 " conflicts",
          lim.compact, delta);
 
+  if (walking)
+    start_walkers ();
+
   STOP (compact);
 }
 
@@ -437,10 +437,9 @@ long Internal::condition_round (long delta) {
 
   // with reimply we might have more trails (which do not contain
   // root assigned literals but might contain fixed literals anyways)
-  int l = 0;
-  for (auto &t : trails) {
-    l++;
-    for (const auto &lit : t) {
+  for (int l = 1; l <= trails.size (); l++) {
+    for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+      const int lit = *p;
       if (fixed (lit) && var (lit).level == l)
         condition_unassign (lit);
     }
@@ -755,11 +754,9 @@ long Internal::condition_round (long delta) {
         assert (!is_conditional_literal (lit));
       }
     }
-    l = 0;
-    for (auto &t : trails) {
-      l++;
-      for (size_t i = 0; i < t.size (); i++) {
-        const int lit = (t)[i];
+    for (int l = 1; l <= trails.size (); l++) {
+      for (int i = 0; i < trail_size (l); i++) {
+        const int lit = trail_lit (l, i);
         if (var (lit).level < l)
           continue;
         assert (var (lit).level == l);
@@ -824,10 +821,9 @@ long Internal::condition_round (long delta) {
       for (const auto &lit : trail)
         if (is_autarky_literal (lit))
           external->push_witness_literal_on_extension_stack (lit);
-      l = 0;
-      for (auto &t : trails) {
-        l++;
-        for (const auto &lit : t) {
+      for (int l = 1; l <= trails.size (); l++) {
+        for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+          const int lit = *p;
           if (is_autarky_literal (lit) && var (lit).level == l) {
             external->push_witness_literal_on_extension_stack (lit);
           }
@@ -925,11 +921,9 @@ long Internal::condition_round (long delta) {
     if (!tmp)
       condition_assign (lit);
   }
-  l = 0;
-  for (auto &t : trails) {
-    l++;
-    for (size_t i = 0; i < t.size (); i++) {
-      const int lit = (t)[i];
+  for (int l = 1; l <= trails.size (); l++) {
+    for (int i = 0; i < trail_size (l); i++) {
+      const int lit = trail_lit (l, i);
       if (var (lit).level < l)
         continue;
       assert (var (lit).level == l);
@@ -943,9 +937,9 @@ long Internal::condition_round (long delta) {
 #ifndef NDEBUG
   for (const auto &lit : trail)
     assert (!marked (lit));
-  for (auto &t : trails)
-    for (const auto &lit : t)
-      assert (!marked (lit));
+  for (int l = 1; l <= trails.size (); l++)
+    for (const int *p = trails.begin (l); p != trails.end (l); p++)
+      assert (!marked (*p));
 #endif
 
   unprotect_reasons ();
@@ -967,7 +961,7 @@ void Internal::condition (bool update_limits) {
   // tried candidate clauses after giving up, such that next time we run
   // 'condition' we can try them.
   //
-  long limit = stats.propagations.search;
+  long limit = stats.ticks.search;
   limit *= opts.conditionreleff;
   limit /= 1000;
   if (limit < opts.conditionmineff)
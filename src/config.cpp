@@ -23,7 +23,7 @@ static NameVal plain_config[1];   // '[0]' gave a warning.
 static NameVal sat_config[] = {
     {"elimreleff", 10},
     {"stabilizeonly", 1},
-    {"subsumereleff", 60},
+    {"subsumereleff", 20},
 };
 
 static NameVal unsat_config[] = {
@@ -104,36 +104,44 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
   assert (val (lit) < 0);
   bool subsumed = false;
   LOG ("asymmetric literal propagation of %d", lit);
+  for (const auto &w : bwatches (lit)) {
+    if (watched (w) == ignore)
+      continue; // costly but necessary here ...
+    const signed char b = val (w.blit);
+    if (b > 0)
+      continue;
+    if (watched (w)->garbage)
+      continue;
+    if (b < 0) {
+      LOG (watched (w), "found subsuming");
+      return true;
+    }
+    asymmetric_literal_addition (-w.blit, coveror);
+  }
   Watches &ws = watches (lit);
   const const_watch_iterator eow = ws.end ();
   watch_iterator j = ws.begin ();
   const_watch_iterator i = j;
   while (!subsumed && i != eow) {
     const Watch w = *j++ = *i++;
-    if (w.clause == ignore)
+    if (watched (w) == ignore)
       continue; // costly but necessary here ...
     const signed char b = val (w.blit);
     if (b > 0)
       continue;
-    if (w.clause->garbage)
+    if (watched (w)->garbage)
       j--;
-    else if (w.binary ()) {
-      if (b < 0) {
-        LOG (w.clause, "found subsuming");
-        subsumed = true;
-      } else
-        asymmetric_literal_addition (-w.blit, coveror);
-    } else {
-      literal_iterator lits = w.clause->begin ();
+    else {
+      literal_iterator lits = watched (w)->begin ();
       const int other = lits[0] ^ lits[1] ^ lit;
       lits[0] = other, lits[1] = lit;
       const signed char u = val (other);
       if (u > 0)
         j[-1].blit = other;
       else {
-        const int size = w.clause->size;
+        const int size = watched (w)->size;
         const const_literal_iterator end = lits + size;
-        const literal_iterator middle = lits + w.clause->pos;
+        const literal_iterator middle = lits + watched (w)->pos;
         literal_iterator k = middle;
         signed char v = -1;
         int r = 0;
@@ -141,26 +149,26 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
           k++;
         if (v < 0) {
           k = lits + 2;
-          assert (w.clause->pos <= size);
+          assert (watched (w)->pos <= size);
           while (k != middle && (v = val (r = *k)) < 0)
             k++;
         }
-        w.clause->pos = k - lits;
-        assert (lits + 2 <= k), assert (k <= w.clause->end ());
+        watched (w)->pos = k - lits;
+        assert (lits + 2 <= k), assert (k <= watched (w)->end ());
         if (v > 0)
           j[-1].blit = r;
         else if (!v) {
-          LOG (w.clause, "unwatch %d in", lit);
+          LOG (watched (w), "unwatch %d in", lit);
           lits[1] = r;
           *k = lit;
-          watch_literal (r, lit, w.clause);
+          watch_literal (r, lit, watched (w));
           j--;
         } else if (!u) {
           assert (v < 0);
           asymmetric_literal_addition (-other, coveror);
         } else {
           assert (u < 0), assert (v < 0);
-          LOG (w.clause, "found subsuming");
+          LOG (watched (w), "found subsuming");
           subsumed = true;
           break;
         }
@@ -484,7 +492,7 @@ int64_t Internal::cover_round () {
   init_watches ();
   connect_watches (true); // irredundant watches only is enough
 
-  int64_t delta = stats.propagations.search;
+  int64_t delta = stats.ticks.search;
   delta *= 1e-3 * opts.coverreleff;
   if (delta < opts.covermineff)
     delta = opts.covermineff;
@@ -97,12 +97,12 @@ bool Internal::satisfied () {
   if (opts.reimply && multitrail_dirty < level)
     return false;
   if (opts.reimply && level &&
-      (size_t) multitrail[level - 1] < trails[level - 1].size ())
+      trails.segment (level).propagated < trails.segment (level).size)
     return false;
 #ifndef NDEBUG
   if (opts.reimply)
-    for (int i = 0; i < level; i++)
-      assert ((size_t) multitrail[i] == trails[i].size ());
+    for (int l = 1; l <= level; l++)
+      assert (trails.segment (l).propagated == trails.segment (l).size);
 #endif
 
   size_t assigned = num_assigned;
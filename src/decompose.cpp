@@ -216,7 +216,7 @@ bool Internal::decompose_round () {
           // Go over all implied literals, thus need to iterate over all
           // binary watched clauses with the negation of 'parent'.
 
-          Watches &ws = watches (-parent);
+          Watches &ws = bwatches (-parent);
 
           // Two cases: Either the node has never been visited before, i.e.,
           // it's depth first search index is zero, then perform the
@@ -235,8 +235,6 @@ bool Internal::decompose_round () {
             unsigned new_min = parent_dfs.min;
 
             for (const auto &w : ws) {
-              if (!w.binary ())
-                continue;
               const int child = w.blit;
               if (!active (child))
                 continue;
@@ -287,10 +285,8 @@ bool Internal::decompose_round () {
                 while (!todo.empty ()) {
                   const int next = todo.back ();
                   todo.pop_back ();
-                  Watches &next_ws = watches (-next);
+                  Watches &next_ws = bwatches (-next);
                   for (const auto &w : next_ws) {
-                    if (!w.binary ())
-                      continue;
                     const int child = w.blit;
                     if (!active (child))
                       continue;
@@ -299,7 +295,7 @@ bool Internal::decompose_round () {
                     DFS &child_dfs = dfs[vlit (child)];
                     if (child_dfs.parent)
                       continue;
-                    child_dfs.parent = w.clause;
+                    child_dfs.parent = watched (w);
                     todo.push_back (child);
                   }
                 }
@@ -401,8 +397,6 @@ bool Internal::decompose_round () {
             // graph but keep 'parent' on the stack for 'post-fix' work.
 
             for (const auto &w : ws) {
-              if (!w.binary ())
-                continue;
               const int child = w.blit;
               if (!active (child))
                 continue;
@@ -649,8 +643,8 @@ bool Internal::decompose_round () {
         mark_added (c);
       // we have assert (c->size > 2)
       if (c->size == 2) { // cheaper to update only new binary clauses
-        update_watch_size (watches (c->literals[0]), c->literals[1], c);
-        update_watch_size (watches (c->literals[1]), c->literals[0], c);
+        update_watch_size (c->literals[0], c->literals[1], c);
+        update_watch_size (c->literals[1], c->literals[0], c);
       }
       LOG (c, "substituted");
     }
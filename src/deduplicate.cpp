@@ -50,7 +50,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
       const int lit = sign * idx; // Consider all literals.
 
       assert (stack.empty ());
-      Watches &ws = watches (lit);
+      Watches &ws = bwatches (lit);
 
       // We are removing references to garbage clause. Thus no 'auto'.
 
@@ -60,11 +60,9 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
 
       for (i = j; !unit && i != end; i++) {
         Watch w = *j++ = *i;
-        if (!w.binary ())
-          continue;
         int other = w.blit;
         const int tmp = marked (other);
-        Clause *c = w.clause;
+        Clause *c = watched (w);
 
         if (tmp > 0) { // Found duplicated binary clause.
 
@@ -82,11 +80,9 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
             watch_iterator k;
             for (k = ws.begin ();; k++) {
               assert (k != i);
-              if (!k->binary ())
-                continue;
               if (k->blit != other)
                 continue;
-              Clause *d = k->clause;
+              Clause *d = watched (*k);
               if (d->garbage)
                 continue;
               c = d;
@@ -115,11 +111,9 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
             // it again
             for (watch_iterator k = ws.begin ();; k++) {
               assert (k != i);
-              if (!k->binary ())
-                continue;
               if (k->blit != -other)
                 continue;
-              lrat_chain.push_back (k->clause->id);
+              lrat_chain.push_back (watched (*k)->id);
               break;
             }
           }
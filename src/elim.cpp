@@ -149,9 +149,11 @@ void Internal::elim_propagate (Eliminator &eliminator, int root) {
     LOG ("elimination propagation of %d", lit);
     assert (val (lit) > 0);
     const Occs &ns = occs (-lit);
+    stats.ticks.elim += 1 + cache_lines (ns);
     for (const auto &c : ns) {
       if (c->garbage)
         continue;
+      stats.ticks.elim += cache_lines (c->bytes ());
       int unit = 0, satisfied = 0;
       for (const auto &other : *c) {
         const signed char tmp = val (other);
@@ -272,6 +274,8 @@ bool Internal::resolve_clauses (Eliminator &eliminator, Clause *c,
 
   if (c->garbage || d->garbage)
     return false;
+
+  stats.ticks.elim += cache_lines (c->bytes ()) + cache_lines (d->bytes ());
   if (c->size > d->size) {
     pivot = -pivot;
     swap (c, d);
@@ -487,7 +491,8 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
   const int64_t neg = ns.size ();
   if (!pos || !neg)
     return lim.elimbound >= 0;
-  const int64_t bound = pos + neg + lim.elimbound;
+  const int64_t bound = pos + neg + elimination_bound (pivot);
+  stats.ticks.elim += 1 + cache_lines (ps) + cache_lines (ns);
 
   LOG ("checking number resolvents on %d bounded by "
        "%" PRId64 " = %" PRId64 " + %" PRId64 " + %" PRId64,
@@ -717,6 +722,292 @@ void Internal::try_to_eliminate_variable (Eliminator &eliminator,
   elim_backward_clauses (eliminator);
 }
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+/*------------------------------------------------------------------------*/
+
+// With 'opts.elimthreads' candidates are popped from the schedule in
+// batches.  A candidate is only added to the current batch if the
+// variables in its clauses (its neighborhood) are disjoint from the
+// neighborhoods of all candidates already in the batch, and otherwise
+// rescheduled after the batch.  This is a greedy coloring of the candidates
+// with one color per batch.  The occurrence lists of the candidates are
+// flushed and sorted and gates are detected on the main thread.  Then the
+// threads compute in parallel whether the number of resolvents is bounded,
+// which is the costly part of elimination and usually fails.  This check is
+// read-only, and if it runs into a case which the sequential check handles
+// through side effects (satisfied antecedents, units or on-the-fly
+// self-subsumption) it gives up.  Finally the main thread goes over the
+// batch in the order the candidates were popped and adds resolvents, pushes
+// clauses on the extension stack and traces the proof for bounded ones.
+
+// Since eliminating a variable only removes clauses with that variable and
+// adds resolvents on variables in its neighborhood, eliminations in the
+// same batch do not influence each other.  The only exception are new root
+// level units (found during gate detection, while adding resolvents or by
+// backward subsumption), after which all remaining candidates of the batch
+// fall back to 'try_to_eliminate_variable'.  The result is independent of
+// the number of threads.
+
+struct Eliminators {
+
+  struct Candidate {
+    int pivot;
+    signed char bounded;    // negative if the check gave up
+    vector<Clause *> gates; // marked gate clauses
+    int64_t tried, resolved, ticks;
+  };
+
+  Internal *internal;
+  vector<Candidate> candidates;
+  vector<vector<signed char>> marks; // per thread
+  vector<unsigned> claimed;          // stamped neighborhoods
+  unsigned stamp;
+  std::atomic<size_t> next;
+
+  Eliminators (Internal *i)
+      : internal (i), marks (i->opts.elimthreads,
+                             vector<signed char> (i->max_var + 1, 0)),
+        claimed (i->max_var + 1, 0), stamp (0), next (0) {}
+
+  void check (Candidate &, vector<signed char> &);
+  void run (unsigned thread);
+};
+
+// Read-only version of 'elim_resolvents_are_bounded'.
+
+void Eliminators::check (Candidate &candidate,
+                         vector<signed char> &mark) {
+  const int pivot = candidate.pivot;
+  const Occs &ps = internal->occs (pivot);
+  const Occs &ns = internal->occs (-pivot);
+  const int64_t pos = ps.size ();
+  const int64_t neg = ns.size ();
+  if (!pos || !neg) {
+    candidate.bounded = internal->lim.elimbound >= 0;
+    return;
+  }
+  const int64_t bound = pos + neg + internal->elimination_bound (pivot);
+  candidate.ticks += 1 + cache_lines (ps) + cache_lines (ns);
+  const bool substitute = !candidate.gates.empty ();
+  const int64_t clslim = internal->opts.elimclslim;
+  int64_t resolvents = 0;
+  candidate.bounded = 0;
+  for (const auto &c : ps) {
+    if (c->garbage)
+      continue;
+    for (const auto &d : ns) {
+      if (d->garbage)
+        continue;
+      if (substitute && c->gate == d->gate)
+        continue;
+      candidate.tried++;
+      candidate.resolved++;
+      candidate.ticks += cache_lines (c->bytes ()) + cache_lines (d->bytes ());
+      Clause *a = c, *b = d;
+      int p = pivot;
+      if (a->size > b->size)
+        p = -p, swap (a, b);
+      int64_t size = 0, s = 0, t = 0;
+      bool satisfied = false, tautological = false;
+      for (const auto &lit : *a) {
+        if (lit == p) {
+          s++;
+          continue;
+        }
+        const signed char tmp = internal->val (lit);
+        if (tmp > 0) {
+          satisfied = true;
+          break;
+        }
+        if (tmp < 0)
+          continue;
+        mark[abs (lit)] = lit < 0 ? -1 : 1;
+        size++, s++;
+      }
+      if (!satisfied)
+        for (const auto &lit : *b) {
+          if (lit == -p) {
+            t++;
+            continue;
+          }
+          const signed char tmp = internal->val (lit);
+          if (tmp > 0) {
+            satisfied = true;
+            break;
+          }
+          if (tmp < 0)
+            continue;
+          const signed char m = lit < 0 ? -mark[-lit] : mark[lit];
+          if (m < 0) {
+            tautological = true;
+            break;
+          }
+          if (!m)
+            size++;
+          t++;
+        }
+      for (const auto &lit : *a)
+        mark[abs (lit)] = 0;
+      if (satisfied) {
+        candidate.bounded = -1;
+        return;
+      }
+      if (tautological)
+        continue;
+      if (size < 2 || s > size || t > size) {
+        candidate.bounded = -1;
+        return;
+      }
+      resolvents++;
+      if (size > clslim || resolvents > bound)
+        return;
+    }
+  }
+  candidate.bounded = 1;
+}
+
+void Eliminators::run (unsigned thread) {
+  for (;;) {
+    const size_t i = next.fetch_add (1, std::memory_order_relaxed);
+    if (i >= candidates.size ())
+      break;
+    check (candidates[i], marks[thread]);
+  }
+}
+
+// Try to eliminate the next batch of candidates and return the number of
+// tried candidates.
+
+int64_t
+Internal::try_to_eliminate_variables_in_parallel (Eliminator &eliminator,
+                                                  Eliminators &eliminators) {
+
+  ElimSchedule &schedule = eliminator.schedule;
+  auto &candidates = eliminators.candidates;
+  const unsigned threads = eliminators.marks.size ();
+  const size_t max_candidates = 256; // independent of 'threads'
+  const size_t max_popped = 4 * max_candidates;
+  const int64_t fixed = stats.all.fixed;
+  const unsigned stamp = ++eliminators.stamp;
+  vector<int> deferred;
+  int64_t tried = 0;
+  size_t popped = 0;
+
+  assert (candidates.empty ());
+  while (!unsat && stats.all.fixed == fixed &&
+         candidates.size () < max_candidates && popped < max_popped &&
+         !schedule.empty ()) {
+    int pivot = schedule.front ();
+    schedule.pop_front ();
+    flags (pivot).elim = false;
+    popped++;
+    if (!active (pivot)) {
+      tried++;
+      continue;
+    }
+    int64_t pos = flush_occs (pivot);
+    int64_t neg = flush_occs (-pivot);
+    if (pos > neg) {
+      pivot = -pivot;
+      swap (pos, neg);
+    }
+    if (pos && neg > opts.elimocclim) {
+      LOG ("too many occurrences thus not eliminated %d", pivot);
+      tried++;
+      continue;
+    }
+    bool independent = true;
+    for (int sign = -1; independent && sign <= 1; sign += 2)
+      for (const auto &c : occs (sign * pivot)) {
+        for (const auto &lit : *c)
+          if (eliminators.claimed[abs (lit)] == stamp) {
+            independent = false;
+            break;
+          }
+        if (!independent)
+          break;
+      }
+    if (!independent) {
+      LOG ("deferring %d to next elimination batch", pivot);
+      deferred.push_back (abs (pivot));
+      continue;
+    }
+    for (int sign = -1; sign <= 1; sign += 2)
+      for (const auto &c : occs (sign * pivot))
+        for (const auto &lit : *c)
+          eliminators.claimed[abs (lit)] = stamp;
+    tried++;
+    LOG ("trying to eliminate %d in parallel", pivot);
+    Occs &ps = occs (pivot);
+    stable_sort (ps.begin (), ps.end (), clause_smaller_size ());
+    Occs &ns = occs (-pivot);
+    stable_sort (ns.begin (), ns.end (), clause_smaller_size ());
+    if (pos)
+      find_gate_clauses (eliminator, pivot);
+    candidates.push_back ({pivot, -1, {}, 0, 0, 0});
+    candidates.back ().gates.swap (eliminator.gates);
+  }
+
+  if (!unsat && stats.all.fixed == fixed && !candidates.empty ()) {
+    eliminators.next = 0;
+    vector<std::thread> running;
+    for (unsigned i = 0; i < threads; i++)
+      running.push_back (std::thread (&Eliminators::run, &eliminators, i));
+    for (auto &thread : running)
+      thread.join ();
+  }
+
+  for (auto &candidate : candidates) {
+    const int pivot = candidate.pivot;
+    assert (eliminator.gates.empty ());
+    eliminator.gates.swap (candidate.gates);
+    if (unsat || schedule.contains (abs (pivot))) {
+      unmark_gate_clauses (eliminator);
+      continue;
+    }
+    if (stats.all.fixed != fixed || candidate.bounded < 0) {
+      unmark_gate_clauses (eliminator);
+      try_to_eliminate_variable (eliminator, pivot);
+      continue;
+    }
+    stats.elimtried++;
+    stats.elimrestried += candidate.tried;
+    stats.elimres += candidate.resolved;
+    stats.ticks.elim += candidate.ticks;
+    if (candidate.bounded) {
+      LOG ("number of resolvents on %d are bounded", pivot);
+      stats.elimpar++;
+      elim_add_resolvents (eliminator, pivot);
+      if (!unsat)
+        mark_eliminated_clauses_as_garbage (eliminator, pivot);
+      if (active (pivot))
+        mark_eliminated (pivot);
+    } else
+      LOG ("too many resolvents on %d so not eliminated", pivot);
+    unmark_gate_clauses (eliminator);
+    elim_backward_clauses (eliminator);
+  }
+  candidates.clear ();
+
+  for (const auto idx : deferred)
+    if (active (idx) && !schedule.contains (idx))
+      schedule.push_back (idx);
+
+  return tried;
+}
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+int64_t Internal::try_to_eliminate_variables_in_parallel (Eliminator &,
+                                                          Eliminators &) {
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+#endif
 /*------------------------------------------------------------------------*/
 
 void Internal::
@@ -749,6 +1040,19 @@ void Internal::
 // variables have been tried).  Otherwise it was asynchronously terminated
 // or the resolution limit was hit.
 
+// Eliminating variables introduced by bounded variable addition ('bva.cpp')
+// while adding clauses would just undo the addition, and thus the bound is
+// not incremented for them.
+
+int64_t Internal::elimination_bound (int pivot) {
+  const int64_t bound = lim.elimbound;
+  if (bound > 0 && external->introduced[abs (i2e[vidx (pivot)])])
+    return 0;
+  return bound;
+}
+
+/*------------------------------------------------------------------------*/
+
 int Internal::elim_round (bool &completed) {
 
   assert (opts.elim);
@@ -760,10 +1064,10 @@ int Internal::elim_round (bool &completed) {
   last.elim.marked = stats.mark.elim;
   assert (!level);
 
-  int64_t resolution_limit;
+  int64_t ticks_limit;
 
   if (opts.elimlimited) {
-    int64_t delta = stats.propagations.search;
+    int64_t delta = stats.ticks.search;
     delta *= 1e-3 * opts.elimreleff;
     if (delta < opts.elimineff)
       delta = opts.elimineff;
@@ -772,12 +1076,12 @@ int Internal::elim_round (bool &completed) {
     delta = max (delta, (int64_t) 2l * active ());
 
     PHASE ("elim-round", stats.elimrounds,
-           "limit of %" PRId64 " resolutions", delta);
+           "limit of %" PRId64 " ticks", delta);
 
-    resolution_limit = stats.elimres + delta;
+    ticks_limit = stats.ticks.elim + delta;
   } else {
-    PHASE ("elim-round", stats.elimrounds, "resolutions unlimited");
-    resolution_limit = LONG_MAX;
+    PHASE ("elim-round", stats.elimrounds, "ticks unlimited");
+    ticks_limit = LONG_MAX;
   }
 
   init_noccs ();
@@ -868,16 +1172,31 @@ int Internal::elim_round (bool &completed) {
   //
 #ifndef QUIET
   int64_t tried = 0;
+#endif
+#ifndef NTHREADS
+  Eliminators *eliminators = 0;
+  if (opts.elimthreads)
+    eliminators = new Eliminators (this);
 #endif
   while (!unsat && !terminated_asynchronously () &&
-         stats.elimres <= resolution_limit && !schedule.empty ()) {
-    int idx = schedule.front ();
-    schedule.pop_front ();
-    flags (idx).elim = false;
-    try_to_eliminate_variable (eliminator, idx);
+         stats.ticks.elim <= ticks_limit && !schedule.empty ()) {
+#ifndef NTHREADS
+    if (eliminators) {
 #ifndef QUIET
-    tried++;
+      tried +=
+#endif
+          try_to_eliminate_variables_in_parallel (eliminator, *eliminators);
+    } else
 #endif
+    {
+      int idx = schedule.front ();
+      schedule.pop_front ();
+      flags (idx).elim = false;
+      try_to_eliminate_variable (eliminator, idx);
+#ifndef QUIET
+      tried++;
+#endif
+    }
     if (stats.garbage.literals <= garbage_limit)
       continue;
     mark_redundant_clauses_with_eliminated_variables_as_garbage ();
@@ -886,10 +1205,14 @@ int Internal::elim_round (bool &completed) {
 
   // If the schedule is empty all variables have been tried (even
   // rescheduled ones).  Otherwise asynchronous termination happened or we
-  // ran into the resolution limit (or derived unsatisfiability).
+  // ran into the ticks limit (or derived unsatisfiability).
   //
   completed = !schedule.size ();
 
+#ifndef NTHREADS
+  delete eliminators;
+#endif
+
   PHASE ("elim-round", stats.elimrounds,
          "tried to eliminate %" PRId64 " variables %.0f%% (%zd remain)",
          tried, percent (tried, scheduled), schedule.size ());
@@ -1008,6 +1331,8 @@ void Internal::elim (bool update_limits) {
 
   reset_watches (); // saves lots of memory
 
+  bva ();
+
   // Alternate one round of bounded variable elimination ('elim_round') and
   // subsumption ('subsume_round'), blocked ('block') and covered clause
   // elimination ('cover') until nothing changes, or the round limit is hit.
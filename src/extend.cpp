@@ -77,7 +77,8 @@ void External::push_binary_clause_on_extension_stack (uint64_t id,
 /*------------------------------------------------------------------------*/
 
 void External::push_external_clause_and_witness_on_extension_stack (
-    const vector<int> &c, const vector<int> &w) {
+    const vector<int> &c, const vector<int> &w, uint64_t id) {
+  assert (id);
   extension.push_back (0);
   for (const auto &elit : w) {
     assert (elit != INT_MIN);
@@ -86,6 +87,8 @@ void External::push_external_clause_and_witness_on_extension_stack (
     mark (witness, elit);
   }
   extension.push_back (0);
+  push_id_on_extension_stack (id);
+  extension.push_back (0);
   for (const auto &elit : c) {
     assert (elit != INT_MIN);
     init (abs (elit));
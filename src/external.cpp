@@ -4,8 +4,8 @@ namespace CaDiCaL {
 
 External::External (Internal *i)
     : internal (i), max_var (0), vsize (0), extended (false), concluded (false),
-      terminator (0), learner (0), propagator (0), solution (0),
-      vars (max_var) {
+      terminator (0), learner (0), importer (0), propagator (0),
+      solution (0), vars (max_var) {
   assert (internal);
   assert (!internal->external);
   internal->external = this;
@@ -65,6 +65,8 @@ void External::init (int new_max_var) {
   }
   if (new_max_var >= (int64_t) is_observed.size ())
     is_observed.resize (1 + (size_t) new_max_var, false);
+  if (new_max_var >= (int64_t) introduced.size ())
+    introduced.resize (1 + (size_t) new_max_var, false);
   if (internal->opts.checkfrozen)
     if (new_max_var >= (int64_t) moltentab.size ())
       moltentab.resize (1 + (size_t) new_max_var, false);
@@ -76,6 +78,83 @@ void External::init (int new_max_var) {
 
 /*------------------------------------------------------------------------*/
 
+// New variables introduced by the solver itself ('bva.cpp') are mapped to
+// the next unused external index.  This keeps witnesses, the extension
+// stack and proofs in terms of external literals as for user variables.
+
+int External::introduce () {
+  assert (max_var < INT_MAX);
+  const int eidx = max_var + 1;
+  init (eidx);
+  introduced[eidx] = true;
+  const int ilit = e2i[eidx];
+  assert (ilit > 0);
+  LOG ("introduced external %d as internal %d", eidx, ilit);
+  return ilit;
+}
+
+// The user is not aware of introduced variables and might start to use
+// their external index at any point.  Then the introduced variable is
+// moved to a fresh external index 'fidx', while the user gets the fresh
+// internal variable allocated for 'fidx', which requires to swap all the
+// external data of the two indices and to rename the literals on the
+// extension stack.  The proof has to follow this renaming too (see
+// 'Internal::rename_introduced_in_proof').
+
+void External::rename_introduced (int eidx) {
+  assert (0 < eidx && eidx <= max_var);
+  assert (introduced[eidx]);
+  if (max_var == INT_MAX)
+    FATAL ("can not rename introduced variable %d", eidx);
+  const int fidx = max_var + 1;
+  init (fidx);
+  const int ilit = e2i[eidx], fresh = e2i[fidx];
+  assert (fresh > 0);
+  LOG ("renaming introduced external %d with internal %d to %d", eidx, ilit,
+       fidx);
+  introduced[eidx] = false;
+  introduced[fidx] = true;
+  e2i[eidx] = fresh;
+  e2i[fidx] = ilit;
+  internal->i2e[fresh] = eidx;
+  const int iidx = abs (ilit);
+  const bool owned = iidx && internal->i2e[iidx] == eidx;
+  if (owned)
+    internal->i2e[iidx] = fidx;
+  swap (ext_units[2 * eidx], ext_units[2 * fidx]);
+  swap (ext_units[2 * eidx + 1], ext_units[2 * fidx + 1]);
+  for (const int sign : {-1, 1}) {
+    const int elit = sign * eidx, flit = sign * fidx;
+    if (marked (witness, elit))
+      unmark (witness, elit), mark (witness, flit);
+    if (marked (tainted, elit))
+      unmark (tainted, elit), mark (tainted, flit);
+  }
+  const auto end = extension.end ();
+  auto p = extension.begin ();
+  while (p != end) {
+    assert (!*p);
+    p++;
+    while (*p) { // witness literals
+      if (abs (*p) == eidx)
+        *p = *p < 0 ? -fidx : fidx;
+      p++;
+    }
+    p += 4; // zero, clause identifier (two entries) and zero
+    assert (!p[-1]);
+    while (p != end && *p) { // clause literals
+      if (abs (*p) == eidx)
+        *p = *p < 0 ? -fidx : fidx;
+      p++;
+    }
+  }
+  if (internal->proof)
+    internal->rename_introduced_in_proof (eidx, fidx, owned ? iidx : 0);
+  internal->stats.bva.renamed++;
+}
+
+/*------------------------------------------------------------------------*/
+
 void External::reset_assumptions () {
   assumptions.clear ();
   internal->reset_assumptions ();
@@ -102,13 +181,15 @@ void External::reset_limits () { internal->reset_limits (); }
 
 /*------------------------------------------------------------------------*/
 
-int External::internalize (int elit) {
+int External::internalize (int elit, bool extension) {
   int ilit;
   if (elit) {
     assert (elit != INT_MIN);
     const int eidx = abs (elit);
     if (eidx > max_var)
       init (eidx);
+    else if (!extension && introduced[eidx])
+      rename_introduced (eidx);
     ilit = e2i[eidx];
     if (elit < 0)
       ilit = -ilit;
@@ -795,8 +876,6 @@ bool External::traverse_all_non_frozen_units_as_witnesses (
 /*------------------------------------------------------------------------*/
 
 void External::copy_flags (External &other) const {
-  const vector<Flags> &this_ftab = internal->ftab;
-  vector<Flags> &other_ftab = other.internal->ftab;
   const unsigned limit = min (max_var, other.max_var);
   for (unsigned eidx = 1; eidx <= limit; eidx++) {
     const int this_ilit = e2i[eidx];
@@ -811,8 +890,8 @@ void External::copy_flags (External &other) const {
       continue;
     assert (this_ilit != INT_MIN);
     assert (other_ilit != INT_MIN);
-    const Flags &this_flags = this_ftab[abs (this_ilit)];
-    Flags &other_flags = other_ftab[abs (other_ilit)];
+    const Flags &this_flags = internal->flags (this_ilit);
+    Flags &other_flags = other.internal->flags (other_ilit);
     this_flags.copy (other_flags);
   }
 }
@@ -828,9 +907,15 @@ void External::export_learned_empty_clause () {
     LOG ("not exporting learned empty clause");
 }
 
+// Clauses with variables introduced by the solver ('bva.cpp') are not
+// exported, since the user (or other solvers exchanging clauses) might use
+// the same external index for different variables.
+
 void External::export_learned_unit_clause (int ilit) {
   assert (learner);
-  if (learner->learning (1)) {
+  if (introduced[abs (internal->externalize (ilit))])
+    LOG ("not exporting learned unit clause on introduced variable");
+  else if (learner->learning (1)) {
     LOG ("exporting learned unit clause");
     const int elit = internal->externalize (ilit);
     assert (elit);
@@ -844,6 +929,11 @@ void External::export_learned_large_clause (const vector<int> &clause) {
   assert (learner);
   size_t size = clause.size ();
   assert (size <= (unsigned) INT_MAX);
+  for (auto ilit : clause)
+    if (introduced[abs (internal->externalize (ilit))]) {
+      LOG ("not exporting learned clause with introduced variable");
+      return;
+    }
   if (learner->learning ((int) size)) {
     LOG ("exporting learned clause of size %zu", size);
     for (auto ilit : clause) {
@@ -31,10 +31,12 @@ using namespace std;
 // The 'External' class provided here stores the information needed to map
 // external variable indices to internal variables (actually literals).
 // This is helpful for shrinking the working size of the internal solver
-// after many variables become inactive.  It will also help to provide
-// support for extended resolution in the future, since it allows to
-// introduce only internally visible variables (even though we do not know
-// how to support generating incremental proofs in this situation yet).
+// after many variables become inactive.  It also allows to introduce new
+// variables during solving, as in bounded variable addition ('bva.cpp'),
+// which get fresh external indices beyond those used by the user so far.
+// If the user later refers to such an index, the introduced variable is
+// silently renamed to another fresh external index (see 'introduce' and
+// 'rename_introduced' below).
 //
 // External literals are usually called 'elit' and internal 'ilit'.
 
@@ -81,6 +83,8 @@ struct External {
   vector<bool> witness; // Literal witness on extension stack.
   vector<bool> tainted; // Literal tainted in adding literals.
 
+  vector<bool> introduced; // Variable introduced by the solver.
+
   vector<unsigned> frozentab; // Reference counts for frozen variables.
 
   // Regularly checked terminator if non-zero.  The terminator is set from
@@ -96,6 +100,10 @@ struct External {
   void export_learned_unit_clause (int ilit);
   void export_learned_large_clause (const vector<int> &);
 
+  // If there is an importer import clauses at restarts.
+
+  Importer *importer;
+
   // If there is an external propagator.
 
   ExternalPropagator *propagator;
@@ -206,7 +214,7 @@ struct External {
   /*----------------------------------------------------------------------*/
 
   void push_external_clause_and_witness_on_extension_stack (
-      const vector<int> &clause, const vector<int> &witness);
+      const vector<int> &clause, const vector<int> &witness, uint64_t id);
 
   void push_id_on_extension_stack (uint64_t id);
 
@@ -245,7 +253,13 @@ struct External {
   void enlarge (int new_max_var); // Enlarge allocated 'vsize'.
   void init (int new_max_var);    // Initialize up-to 'new_max_var'.
 
-  int internalize (int); // Translate external to internal literal.
+  // Translate external to internal literal.  Unless the literal is taken
+  // from the extension stack, an introduced variable is renamed first.
+  //
+  int internalize (int, bool extension = false);
+
+  int introduce ();                  // Returns new internal variable.
+  void rename_introduced (int eidx); // Move away from user index.
 
   /*----------------------------------------------------------------------*/
 
@@ -472,9 +472,8 @@ void Internal::explain_external_propagations () {
     }
   } else {
     for (int l = level; l >= 0; l--) {
-      const auto &t = next_trail (l);
-      for (auto p = (*t).rbegin (); p != (*t).rend (); p++) {
-        const int lit = *p;
+      for (int i = trail_size (l); i--;) {
+        const int lit = trail_lit (l, i);
         if (!flags (lit).seen)
           continue;
         seen_lits.push_back (lit);
@@ -523,8 +522,8 @@ void Internal::explain_external_propagations () {
             trail.push_back (lit);
             multitrail_dirty = 0;
           } else {
-            v.trail = trails[real_level - 1].size ();
-            trails[real_level - 1].push_back (lit);
+            v.trail = trail_size (real_level);
+            trails.push (real_level, lit);
             if (real_level < multitrail_dirty)
               multitrail_dirty = real_level;
           }
@@ -874,8 +873,9 @@ void Internal::connect_propagator () {
     flags (lit).seen = true;
     notify_trail.push_back (lit);
   }
-  for (auto &t : trails) {
-    for (auto lit : t) {
+  for (int l = 1; l <= trails.size (); l++) {
+    for (const int *p = trails.begin (l); p != trails.end (l); p++) {
+      const int lit = *p;
       if (flags (lit).seen)
         continue;
       flags (lit).seen = true;
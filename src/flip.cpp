@@ -31,17 +31,10 @@ bool Internal::flip (int lit) {
 
   bool res = true;
 
-  Watches &ws = watches (lit);
-  const const_watch_iterator eow = ws.end ();
-  watch_iterator bow = ws.begin ();
-
   // We first go over binary watches/clauses first as this is cheaper and
   // has higher chance of failure and we can not use blocking literals.
 
-  for (const_watch_iterator i = bow; i != eow; i++) {
-    const Watch w = *i;
-    if (!w.binary ())
-      continue;
+  for (const auto &w : bwatches (lit)) {
     const signed char b = val (w.blit);
     if (b > 0)
       continue;
@@ -51,30 +44,29 @@ bool Internal::flip (int lit) {
   }
 
   if (res) {
-    const_watch_iterator i = bow;
-    watch_iterator j = bow;
+    Watches &ws = watches (lit);
+    const const_watch_iterator eow = ws.end ();
+    const_watch_iterator i = ws.begin ();
+    watch_iterator j = ws.begin ();
 
     while (i != eow) {
 
       const Watch w = *j++ = *i++;
 
-      if (w.binary ())
-        continue;
-
-      if (w.clause->garbage) {
+      if (watched (w)->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = watched (w)->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
       if (u > 0)
         continue;
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = watched (w)->size;
+      const literal_iterator middle = lits + watched (w)->pos;
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -84,7 +76,7 @@ bool Internal::flip (int lit) {
         k++;
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (watched (w)->pos <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
@@ -95,10 +87,10 @@ bool Internal::flip (int lit) {
       }
 
       assert (v > 0);
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= watched (w)->end ());
+      watched (w)->pos = k - lits;
       lits[0] = other, lits[1] = r, *k = lit;
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, watched (w));
       j--;
     }
 
@@ -134,8 +126,8 @@ bool Internal::flip (int lit) {
     Var &v = var (idx);
     if (opts.reimply) {
       assert (v.level);
-      assert (trails[v.level - 1][v.trail] == lit);
-      trails[v.level - 1][v.trail] = -lit;
+      assert (trails.lit (v.level, v.trail) == lit);
+      trails.lit (v.level, v.trail) = -lit;
     } else {
       assert (trail[v.trail] == lit);
       trail[v.trail] = -lit;
@@ -180,8 +172,11 @@ bool Internal::flippable (int lit) {
   // Here we go over all the clauses in which 'lit' is watched by 'lit' and
   // check whether assigning 'lit' to false would break watching invariants
   // or even make the clause false.  In contrast to 'flip' we do not try to
-  // find replacement literals but do use blocking literals'.  Therefore we
-  // also do not split the traversal code into two parts.
+  // find replacement literals but do use blocking literals'.
+
+  for (const auto &w : bwatches (lit))
+    if (val (w.blit) < 0)
+      return false;
 
   bool res = true;
 
@@ -195,15 +190,10 @@ bool Internal::flippable (int lit) {
       continue;
     assert (b < 0);
 
-    if (w.binary ()) {
-      res = false;
-      break;
-    }
-
-    if (w.clause->garbage)
+    if (watched (w)->garbage)
       continue;
 
-    literal_iterator lits = w.clause->begin ();
+    literal_iterator lits = watched (w)->begin ();
 
     const int other = lits[0] ^ lits[1] ^ lit;
     const signed char u = val (other);
@@ -212,8 +202,8 @@ bool Internal::flippable (int lit) {
       continue;
     }
 
-    const int size = w.clause->size;
-    const literal_iterator middle = lits + w.clause->pos;
+    const int size = watched (w)->size;
+    const literal_iterator middle = lits + watched (w)->pos;
     const const_literal_iterator end = lits + size;
     literal_iterator k = middle;
 
@@ -223,7 +213,7 @@ bool Internal::flippable (int lit) {
       k++;
     if (v < 0) {
       k = lits + 2;
-      assert (w.clause->pos <= size);
+      assert (watched (w)->pos <= size);
       while (k != middle && (v = val (r = *k)) < 0)
         k++;
     }
@@ -235,8 +225,8 @@ bool Internal::flippable (int lit) {
 
     assert (v > 0);
     assert (lits + 2 <= k);
-    assert (k <= w.clause->end ());
-    w.clause->pos = k - lits;
+    assert (k <= watched (w)->end ());
+    watched (w)->pos = k - lits;
     i->blit = r;
   }
 
@@ -0,0 +1,620 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Gauss-Jordan elimination on XOR constraints.  On the root level we
+// extract XORs from their full CNF encoding in the irredundant clauses
+// (all '2^(n-1)' clauses over the same 'n' variables with the same parity
+// of negative literals).  The XORs are partitioned into components
+// connected by shared variables.  Each component with at least two XORs
+// becomes a matrix of bit-packed rows, which is brought into reduced row
+// echelon form.  This already yields units and shows inconsistency.  More
+// importantly, the reduced rows are linear combinations of the original
+// XORs, which unit propagation on the CNF encoding can not see.
+//
+// During search each reduced row watches two columns.  If a watched
+// variable is assigned we scan the row and either find two unassigned
+// columns to watch, or propagate the last unassigned column, or find the
+// row to be falsified.  Propagations and conflicts are explained eagerly
+// by adding the implied clause (the propagated literal or conflicting
+// assignment and the negation of the assignment to all other columns) as
+// learned redundant clause.  Since this clause is watched too, the same
+// implication is found by unit propagation afterwards and the rest of the
+// solver ('analyze', 'minimize', 'reduce', trail saving, etc.) only sees
+// clauses.  After a row is propagated or found falsified it watches the
+// columns assigned last, which as for clauses keeps the watches valid
+// after backtracking.
+//
+// Those clauses are not RUP in general, and thus this technique is
+// disabled if proofs are generated or checked.  It is also disabled with
+// external propagators.  It does not support 'reimply' either, where the
+// trail is split into one trail per level, and thus enabling 'gauss'
+// disables 'reimply' and vice versa (see 'Options::set').
+// The rows are only built on the root level.  They become invalid if one
+// of their variables is eliminated or substituted and after compacting
+// variable indices, and they are rebuilt if new irredundant clauses were
+// added (as XORs might have been completed).  The XORs are implied by the
+// formula, and thus by any formula obtained through variable elimination
+// or clause elimination of the remaining variables.
+
+/*------------------------------------------------------------------------*/
+
+// XOR candidate clause with sorted variables at 'offset' and 'negs' with
+// bit 'i' set if the 'i'-th literal is negative.
+
+struct GaussCandidate {
+  uint64_t hash;
+  unsigned offset, size, negs;
+};
+
+bool Internal::gauss_enabled () {
+  return opts.gauss && !proof && !lrat && !external_prop && !opts.reimply;
+}
+
+// Variables of rows are still active and indices are the same.
+
+bool Internal::gauss_valid () {
+  const int64_t inactive =
+      stats.all.eliminated + stats.all.substituted + stats.all.pure;
+  return last.gauss.inactive == inactive &&
+         last.gauss.compacts == stats.compacts;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Remove row 'r' from the watches of 'idx'.
+
+void Internal::gauss_unwatch (unsigned r, int idx) {
+  vector<unsigned> &ws = gauss.watches[idx];
+  const auto i = std::find (ws.begin (), ws.end (), r);
+  assert (i != ws.end ());
+  *i = ws.back ();
+  ws.pop_back ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Find all XORs of size at most 'gaussxorlim' and add their variables to
+// 'vars' and themselves to 'xors'.
+
+void Internal::gauss_find_xors (vector<int> &vars, vector<GaussXor> &xors) {
+
+  const unsigned limit = opts.gaussxorlim;
+  vector<int> lits;
+  vector<GaussCandidate> candidates;
+  int64_t ticks = 0;
+
+  for (const auto &c : clauses) {
+    ticks++;
+    if (c->garbage || c->redundant)
+      continue;
+    if (c->size < 3 || (unsigned) c->size > limit)
+      continue;
+    ticks += cache_lines (c->bytes ());
+    bool assigned = false;
+    for (const auto &lit : *c)
+      if (val (lit)) {
+        assigned = true;
+        break;
+      }
+    if (assigned)
+      continue;
+    const unsigned offset = lits.size ();
+    for (const auto &lit : *c)
+      lits.push_back (lit);
+    const auto begin = lits.begin () + offset;
+    sort (begin, lits.end (),
+          [] (int a, int b) { return abs (a) < abs (b); });
+    uint64_t hash = 0;
+    unsigned negs = 0;
+    for (unsigned i = 0; i < (unsigned) c->size; i++) {
+      const int lit = begin[i];
+      hash = 1000000007ull * hash + abs (lit);
+      if (lit < 0)
+        negs |= 1u << i;
+    }
+    candidates.push_back ({hash, offset, (unsigned) c->size, negs});
+  }
+
+  LOG ("found %zd XOR candidate clauses", candidates.size ());
+
+  const auto same_vars = [&lits] (const GaussCandidate &a,
+                                  const GaussCandidate &b) {
+    if (a.size != b.size || a.hash != b.hash)
+      return false;
+    for (unsigned i = 0; i < a.size; i++)
+      if (abs (lits[a.offset + i]) != abs (lits[b.offset + i]))
+        return false;
+    return true;
+  };
+
+  sort (candidates.begin (), candidates.end (),
+        [&lits] (const GaussCandidate &a, const GaussCandidate &b) {
+          if (a.size != b.size)
+            return a.size < b.size;
+          if (a.hash != b.hash)
+            return a.hash < b.hash;
+          for (unsigned i = 0; i < a.size; i++) {
+            const int u = abs (lits[a.offset + i]);
+            const int v = abs (lits[b.offset + i]);
+            if (u != v)
+              return u < v;
+          }
+          return a.negs < b.negs;
+        });
+
+  const auto end = candidates.end ();
+  auto i = candidates.begin ();
+  while (i != end) {
+    auto j = i + 1;
+    while (j != end && same_vars (*i, *j))
+      j++;
+    const unsigned size = i->size;
+    const unsigned needed = 1u << (size - 1);
+    if ((unsigned) (j - i) >= needed) {
+      unsigned count[2] = {0, 0};
+      for (auto k = i; k != j; k++)
+        if (k == i || k[-1].negs != k->negs)
+          count[__builtin_popcount (k->negs) & 1]++;
+      for (unsigned parity = 0; parity < 2; parity++) {
+        if (count[parity] != needed)
+          continue;
+        // All assignments with this parity of variables set to true are
+        // excluded and thus the other parity is required.
+        const unsigned offset = vars.size ();
+        for (unsigned l = 0; l < size; l++)
+          vars.push_back (abs (lits[i->offset + l]));
+        xors.push_back ({offset, size, !parity});
+        LOG (vars.cbegin () + offset, vars.cend (),
+             "found XOR with parity %d over", (int) !parity);
+      }
+    }
+    ticks += j - i;
+    i = j;
+  }
+
+  stats.ticks.gauss += ticks;
+  stats.gauss.xors += xors.size ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Bring the matrix with the given rows in reduced row echelon form.  Then
+// add the remaining rows with at least two columns and return the units.
+// Returns false if the rows are inconsistent.
+
+bool Internal::gauss_eliminate (GaussMatrix &matrix, vector<uint64_t> &bits,
+                                vector<char> &rhs, vector<int> &units) {
+
+  const unsigned words = matrix.words;
+  const unsigned columns = matrix.vars.size ();
+  const unsigned rows = rhs.size ();
+  int64_t ticks = 0;
+
+  unsigned rank = 0;
+  for (unsigned col = 0; col < columns && rank < rows; col++) {
+    const unsigned w = col / 64;
+    const uint64_t mask = (uint64_t) 1 << (col & 63);
+    unsigned pivot = rank;
+    while (pivot < rows && !(bits[pivot * words + w] & mask))
+      pivot++;
+    ticks += pivot - rank;
+    if (pivot == rows)
+      continue;
+    uint64_t *p = &bits[rank * words];
+    if (pivot != rank) {
+      std::swap_ranges (p, p + words, &bits[pivot * words]);
+      std::swap (rhs[pivot], rhs[rank]);
+    }
+    for (unsigned r = 0; r < rows; r++) {
+      if (r == rank)
+        continue;
+      uint64_t *q = &bits[r * words];
+      ticks++;
+      if (!(q[w] & mask))
+        continue;
+      for (unsigned k = 0; k < words; k++)
+        q[k] ^= p[k];
+      rhs[r] ^= rhs[rank];
+      ticks += cache_lines (words * sizeof (uint64_t));
+    }
+    rank++;
+  }
+  stats.ticks.gauss += ticks;
+
+  for (unsigned r = rank; r < rows; r++)
+    if (rhs[r]) {
+      LOG ("inconsistent XOR constraints");
+      return false;
+    }
+
+  const unsigned m = gauss.matrices.size ();
+  const size_t before = gauss.rows.size ();
+  vector<uint64_t> kept;
+  for (unsigned r = 0; r < rank; r++) {
+    const uint64_t *p = &bits[r * words];
+    unsigned count = 0, watch[2] = {0, 0};
+    for (unsigned k = 0; k < words && count < 2; k++) {
+      uint64_t word = p[k];
+      while (word && count < 2) {
+        watch[count++] = 64 * k + __builtin_ctzll (word);
+        word &= word - 1;
+      }
+    }
+    assert (count);
+    if (count == 1) {
+      const int idx = matrix.vars[watch[0]];
+      units.push_back (rhs[r] ? idx : -idx);
+      continue;
+    }
+    const unsigned offset = kept.size ();
+    kept.insert (kept.end (), p, p + words);
+    const unsigned row = gauss.rows.size ();
+    gauss.rows.push_back ({m, offset, {watch[0], watch[1]}, !!rhs[r]});
+    for (const auto &col : watch)
+      gauss.watches[matrix.vars[col]].push_back (row);
+  }
+
+  if (!kept.empty ()) {
+    matrix.bits.swap (kept);
+    gauss.matrices.push_back (std::move (matrix));
+    stats.gauss.matrices++;
+    stats.gauss.rows += gauss.rows.size () - before;
+  }
+
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Extract XORs and build the reduced matrices on the root level.
+
+void Internal::gauss_extract () {
+
+  assert (!level);
+  assert (!unsat);
+  assert (propagated == trail.size ());
+
+  START (gauss);
+  stats.gauss.extractions++;
+
+  last.gauss.added = stats.added.irredundant;
+  last.gauss.inactive =
+      stats.all.eliminated + stats.all.substituted + stats.all.pure;
+  last.gauss.compacts = stats.compacts;
+
+  gauss.erase ();
+  gauss.watches.resize (max_var + 1);
+
+  vector<int> vars;
+  vector<GaussXor> xors;
+  gauss_find_xors (vars, xors);
+
+  // Find connected components of XORs with union-find on variables.
+
+  vector<int> repr (max_var + 1, 0);
+  const auto find = [&repr] (int idx) {
+    while (repr[idx] != idx)
+      idx = repr[idx] = repr[repr[idx]];
+    return idx;
+  };
+  for (const auto &x : xors) {
+    const int first = vars[x.offset];
+    if (!repr[first])
+      repr[first] = first;
+    int root = find (first);
+    for (unsigned i = 1; i < x.size; i++) {
+      const int idx = vars[x.offset + i];
+      if (!repr[idx])
+        repr[idx] = idx;
+      int other = find (idx);
+      if (other == root)
+        continue;
+      if (other < root)
+        std::swap (root, other);
+      repr[other] = root;
+    }
+  }
+
+  vector<unsigned> schedule (xors.size ());
+  vector<int> roots (xors.size ());
+  for (unsigned i = 0; i < xors.size (); i++)
+    schedule[i] = i, roots[i] = find (vars[xors[i].offset]);
+  stable_sort (schedule.begin (), schedule.end (),
+               [&roots] (unsigned a, unsigned b) {
+                 return roots[a] < roots[b];
+               });
+
+  // Use 'repr' to map variables to columns from now on.
+
+  for (auto &idx : repr)
+    idx = -1;
+
+  vector<int> units;
+  vector<uint64_t> bits;
+  vector<char> rhs;
+  bool inconsistent = false;
+
+  const auto end = schedule.end ();
+  auto i = schedule.begin ();
+  while (!inconsistent && i != end) {
+    auto j = i + 1;
+    while (j != end && roots[*j] == roots[*i])
+      j++;
+    const unsigned rows = j - i;
+    if (rows < 2) {
+      i = j;
+      continue;
+    }
+    GaussMatrix matrix;
+    for (auto k = i; k != j; k++) {
+      const GaussXor &x = xors[*k];
+      for (unsigned l = 0; l < x.size; l++) {
+        const int idx = vars[x.offset + l];
+        if (repr[idx] >= 0)
+          continue;
+        repr[idx] = matrix.vars.size ();
+        matrix.vars.push_back (idx);
+      }
+    }
+    const unsigned columns = matrix.vars.size ();
+    if (columns <= (unsigned) opts.gausscollim) {
+      LOG ("matrix with %u rows and %u columns", rows, columns);
+      const unsigned words = (columns + 63) / 64;
+      matrix.words = words;
+      bits.assign ((size_t) rows * words, 0);
+      rhs.resize (rows);
+      for (unsigned r = 0; r < rows; r++) {
+        const GaussXor &x = xors[i[r]];
+        uint64_t *p = &bits[r * words];
+        for (unsigned l = 0; l < x.size; l++) {
+          const unsigned col = repr[vars[x.offset + l]];
+          p[col / 64] |= (uint64_t) 1 << (col & 63);
+        }
+        rhs[r] = x.rhs;
+      }
+      inconsistent = !gauss_eliminate (matrix, bits, rhs, units);
+    } else
+      LOG ("skipping matrix with %u rows and %u columns", rows, columns);
+    for (const auto &idx : matrix.vars)
+      repr[idx] = -1;
+    i = j;
+  }
+
+  if (inconsistent)
+    learn_empty_clause ();
+  else
+    for (const auto &lit : units) {
+      assert (!val (lit));
+      stats.gauss.units++;
+      assign_unit (lit);
+    }
+
+  gauss.propagated = trail.size ();
+
+  PHASE ("gauss", stats.gauss.extractions,
+         "found %zd XORs reduced to %zd rows in %zd matrices and %zd units",
+         xors.size (), gauss.rows.size (), gauss.matrices.size (),
+         units.size ());
+
+  STOP (gauss);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Add the clause implied by 'row' for the propagation of 'lit' (or for a
+// conflict if 'lit' is zero) with the highest level literals watched.
+
+Clause *Internal::gauss_new_clause (const GaussRow &row, int lit) {
+
+  assert (clause.empty ());
+  const GaussMatrix &matrix = gauss.matrices[row.matrix];
+  const uint64_t *bits = &matrix.bits[row.bits];
+
+  if (lit)
+    clause.push_back (lit);
+  for (unsigned k = 0; k < matrix.words; k++) {
+    uint64_t word = bits[k];
+    while (word) {
+      const int idx = matrix.vars[64 * k + __builtin_ctzll (word)];
+      word &= word - 1;
+      if (idx == abs (lit))
+        continue;
+      const signed char tmp = val (idx);
+      assert (tmp);
+      clause.push_back (tmp < 0 ? idx : -idx);
+    }
+  }
+
+  const size_t size = clause.size ();
+  assert (size > 1);
+  for (size_t i = !!lit; i < 2; i++) {
+    size_t highest = i;
+    for (size_t j = i + 1; j < size; j++)
+      if (var (clause[j]).level > var (clause[highest]).level)
+        highest = j;
+    std::swap (clause[i], clause[highest]);
+  }
+
+  vector<int> &levels = gauss.levels;
+  for (size_t i = !!lit; i < size; i++)
+    levels.push_back (var (clause[i]).level);
+  sort (levels.begin (), levels.end ());
+  const int highest = levels.back ();
+  int glue = unique (levels.begin (), levels.end ()) - levels.begin ();
+  if (lit && highest < level)
+    glue++;
+  levels.clear ();
+
+  external->check_learned_clause ();
+  Clause *c = new_clause (true, glue);
+  c->used = 1 + (glue <= opts.reducetier2glue);
+  watch_clause (c);
+  clause.clear ();
+  return c;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Visit the rows watching the variable of the assigned literal 'lit'.
+
+void Internal::gauss_propagate_literal (int lit) {
+
+  const int idx = vidx (lit);
+  if ((size_t) idx >= gauss.watches.size ())
+    return;
+  vector<unsigned> &ws = gauss.watches[idx];
+  if (ws.empty ())
+    return;
+
+  LOG ("gauss propagating %d", lit);
+  int64_t ticks = 0;
+
+  const auto end = ws.end ();
+  auto j = ws.begin (), i = j;
+
+  while (i != end) {
+
+    const unsigned r = *j++ = *i++;
+    GaussRow &row = gauss.rows[r];
+    const GaussMatrix &matrix = gauss.matrices[row.matrix];
+    const uint64_t *bits = &matrix.bits[row.bits];
+    const int *vars = matrix.vars.data ();
+    ticks += 1 + cache_lines (matrix.words * sizeof (uint64_t));
+
+    // Find two unassigned columns or the two highest assigned columns.
+
+    unsigned unassigned[2] = {0, 0}, highest[2] = {0, 0}, found = 0;
+    int levels[2] = {-1, -1};
+    bool parity = row.rhs;
+
+    for (unsigned k = 0; found < 2 && k < matrix.words; k++) {
+      uint64_t word = bits[k];
+      while (word) {
+        const unsigned col = 64 * k + __builtin_ctzll (word);
+        word &= word - 1;
+        const int other = vars[col];
+        const signed char tmp = val (other);
+        if (!tmp) {
+          unassigned[found++] = col;
+          if (found == 2)
+            break;
+          continue;
+        }
+        if (tmp > 0)
+          parity = !parity;
+        const int other_level = var (other).level;
+        if (other_level > levels[0]) {
+          levels[1] = levels[0], highest[1] = highest[0];
+          levels[0] = other_level, highest[0] = col;
+        } else if (other_level > levels[1])
+          levels[1] = other_level, highest[1] = col;
+      }
+    }
+
+    unsigned watch[2];
+    if (found == 2)
+      watch[0] = unassigned[0], watch[1] = unassigned[1];
+    else if (found == 1) {
+      // The remaining column has to be assigned to 'parity'.
+      const int other = vars[unassigned[0]];
+      const int forced = parity ? other : -other;
+      stats.gauss.propagations++;
+      if (level) {
+        Clause *reason = gauss_new_clause (row, forced);
+        LOG (reason, "gauss propagating %d with", forced);
+        search_assign_driving (forced, reason);
+      } else {
+        LOG ("gauss propagating unit %d", forced);
+        stats.gauss.units++;
+        assign_unit (forced);
+      }
+      watch[0] = unassigned[0], watch[1] = highest[0];
+    } else {
+      if (parity) {
+        conflict = gauss_new_clause (row, 0);
+        LOG (conflict, "gauss conflict");
+        stats.gauss.conflicts++;
+      }
+      watch[0] = highest[0], watch[1] = highest[1];
+    }
+
+    // Update watches, where 'r' stays in 'ws' if it still watches 'idx'.
+
+    bool keep = false;
+    for (const auto &col : watch) {
+      if (col == row.watch[0] || col == row.watch[1]) {
+        if (vars[col] == idx)
+          keep = true;
+        continue;
+      }
+      gauss.watches[vars[col]].push_back (r);
+    }
+    for (const auto &col : row.watch) {
+      if (col == watch[0] || col == watch[1])
+        continue;
+      if (vars[col] != idx)
+        gauss_unwatch (r, vars[col]);
+    }
+    row.watch[0] = watch[0], row.watch[1] = watch[1];
+    if (!keep)
+      j--;
+
+    if (conflict) {
+      while (i != end)
+        *j++ = *i++;
+      break;
+    }
+  }
+
+  ws.resize (j - ws.begin ());
+  stats.ticks.gauss += ticks;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Called in the search loop after unit propagation without conflict.  It
+// alternates propagation of rows and clauses until completion or conflict.
+
+bool Internal::gauss_propagate () {
+
+  if (!gauss_enabled ())
+    return true;
+
+  if (!gauss_valid () ||
+      last.gauss.added != stats.added.irredundant) {
+    if (level) {
+      if (!gauss_valid ())
+        return true;
+    } else {
+      gauss_extract ();
+      if (unsat)
+        return true;
+    }
+  }
+
+  if (gauss.rows.empty ())
+    return propagated == trail.size () || propagate ();
+
+  while (!conflict) {
+    if (propagated < trail.size ()) {
+      if (!propagate ())
+        break;
+    } else if (gauss.propagated < trail.size ())
+      gauss_propagate_literal (trail[gauss.propagated++]);
+    else
+      break;
+    if (conflict) {
+      if (stable)
+        stats.stabconflicts++;
+      stats.conflicts++;
+      no_conflict_until = control[level].trail;
+    }
+  }
+
+  return !conflict;
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,54 @@
+#ifndef _gauss_hpp_INCLUDED
+#define _gauss_hpp_INCLUDED
+
+#include <cstdint>
+#include <vector>
+
+namespace CaDiCaL {
+
+// XOR constraints extracted from the irredundant clauses are partitioned
+// into independent matrices (connected through shared variables).  Each
+// matrix is reduced with Gauss-Jordan elimination on bit-packed rows and
+// the remaining rows are propagated during search with two watched columns
+// per row (see 'gauss.cpp').
+
+struct GaussMatrix {
+  unsigned words;             // 64-bit words per row
+  std::vector<int> vars;      // variable of each column
+  std::vector<uint64_t> bits; // 'words' per row
+};
+
+struct GaussXor {
+  unsigned offset, size; // of variables in extracted XOR
+  bool rhs;              // parity of the XOR
+};
+
+struct GaussRow {
+  unsigned matrix;   // index in 'Gauss.matrices'
+  unsigned bits;     // offset of first word in 'GaussMatrix.bits'
+  unsigned watch[2]; // watched columns
+  bool rhs;          // parity of the row
+};
+
+struct Gauss {
+
+  std::vector<GaussMatrix> matrices;
+  std::vector<GaussRow> rows;
+  std::vector<std::vector<unsigned>> watches; // rows watching variables
+  std::vector<int> levels;                    // to compute glue of reasons
+  size_t propagated;                          // next trail position
+
+  Gauss () : propagated (0) {}
+
+  void erase () {
+    std::vector<GaussMatrix> ().swap (matrices);
+    std::vector<GaussRow> ().swap (rows);
+    std::vector<std::vector<unsigned>> ().swap (watches);
+    std::vector<int> ().swap (levels);
+    propagated = 0;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
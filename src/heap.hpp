@@ -16,6 +16,12 @@ using namespace std;
 // implement the mapping externally provided by another template parameter.
 // Since we use 'UINT_MAX' as 'not contained' flag, we can only have
 // 'UINT_MAX - 1' elements in the heap.
+//
+// The arity of the heap can be changed to any power of two with 'reshape'.
+// With larger arity the heap is shallower and all children of a node are
+// consecutive in 'array' (four children fit into one 16 byte chunk), which
+// reduces the number of cache lines touched while bubbling down, at the
+// price of more comparisons per level.
 
 const unsigned invalid_heap_position = UINT_MAX;
 
@@ -24,6 +30,7 @@ template <class C> class heap {
   vector<unsigned> array; // actual binary heap
   vector<unsigned> pos;   // positions of elements in array
   C less;                 // less-than for elements
+  unsigned shift;         // log2 of the arity (binary heap by default)
 
   // Map an element to its position entry in the 'pos' map.
   //
@@ -36,27 +43,15 @@ template <class C> class heap {
   }
 
   bool has_parent (unsigned e) { return index (e) > 0; }
-  bool has_left (unsigned e) {
-    return (size_t) 2 * index (e) + 1 < size ();
-  }
-  bool has_right (unsigned e) {
-    return (size_t) 2 * index (e) + 2 < size ();
-  }
 
   unsigned parent (unsigned e) {
     assert (has_parent (e));
-    return array[(index (e) - 1) / 2];
-  }
-
-  unsigned left (unsigned e) {
-    assert (has_left (e));
-    return array[2 * index (e) + 1];
+    return array[(index (e) - 1) >> shift];
   }
 
-  unsigned right (unsigned e) {
-    assert (has_right (e));
-    return array[2 * index (e) + 2];
-  }
+  // Position of the first child of the element at position 'i'.
+  //
+  size_t first_child (size_t i) const { return (i << shift) + 1; }
 
   // Exchange elements 'a' and 'b' in 'array' and fix their positions.
   //
@@ -77,12 +72,19 @@ template <class C> class heap {
   // Bubble down an element as far as necessary.
   //
   void down (unsigned e) {
-    while (has_left (e)) {
-      unsigned c = left (e);
-      if (has_right (e)) {
-        unsigned r = right (e);
-        if (less (c, r))
-          c = r;
+    const size_t n = size ();
+    for (;;) {
+      size_t i = first_child (index (e));
+      if (i >= n)
+        break;
+      size_t end = i + ((size_t) 1 << shift);
+      if (end > n)
+        end = n;
+      unsigned c = array[i];
+      while (++i < end) {
+        const unsigned o = array[i];
+        if (less (c, o))
+          c = o;
       }
       if (!less (e, c))
         break;
@@ -100,9 +102,8 @@ template <class C> class heap {
 #warning "expensive checking in heap enabled"
     assert (array.size () <= invalid_heap_position);
     for (size_t i = 0; i < array.size (); i++) {
-      size_t l = 2*i + 1, r = 2*i + 2;
-      if (l < array.size ()) assert (!less (array[i], array[l]));
-      if (r < array.size ()) assert (!less (array[i], array[r]));
+      for (size_t j = first_child (i), k = 0; k < (1u << shift); j++, k++)
+        if (j < array.size ()) assert (!less (array[i], array[j]));
       assert (array[i] >= 0);
       {
         assert ((size_t) array[i] < pos.size ());
@@ -118,7 +119,26 @@ template <class C> class heap {
   }
 
 public:
-  heap (const C &c) : less (c) {}
+  heap (const C &c) : less (c), shift (1) {}
+
+  // Arity of the heap (always a power of two).
+  //
+  unsigned arity () const { return 1u << shift; }
+
+  // Change the arity to the largest power of two not larger than 'a' (at
+  // least two) and restore the heap property bottom-up.
+  //
+  void reshape (unsigned a) {
+    unsigned s = 1;
+    while (s < 16 && (2u << s) <= a)
+      s++;
+    if (s == shift)
+      return;
+    shift = s;
+    for (size_t i = size (); i--;)
+      down (array[i]);
+    check ();
+  }
 
   // Number of elements in the heap.
   //
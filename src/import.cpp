@@ -0,0 +1,83 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Importing clauses from a connected importer (see 'Importer' in
+// 'cadical.hpp'), for instance learned clauses of other solvers running in
+// parallel on the same formula (see '--threads' in 'cadical.cpp').  This
+// happens during restarts and all clauses are added on the root level.
+// Imported clauses have to be implied by the formula, but since we can not
+// justify them, we do not import anything while tracing proofs.
+
+// The result is 'false' if there was nothing to import, in which case we
+// did not backtrack either.
+
+bool Internal::import_clauses () {
+  Importer *importer = external->importer;
+  assert (importer);
+  assert (!proof);
+  if (!importer->importing ())
+    return false;
+  if (level)
+    backtrack ();
+  LOG ("importing clauses");
+  assert (clause.empty ());
+  do {
+    bool ignore = false;
+    int elit;
+    while ((elit = importer->import ())) {
+      if (ignore)
+        continue;
+      const int eidx = abs (elit);
+      int ilit = 0;
+      if (eidx <= external->max_var && !external->introduced[eidx])
+        ilit = external->e2i[eidx];
+      if (!ilit) { // Unknown or introduced variable (see 'bva.cpp').
+        ignore = true;
+        continue;
+      }
+      if (elit < 0)
+        ilit = -ilit;
+      const signed char tmp = val (ilit);
+      if (tmp > 0)
+        ignore = true; // Satisfied.
+      else if (tmp < 0)
+        continue; // Falsified literal.
+      else if (!active (ilit))
+        ignore = true; // Eliminated or substituted variable.
+      else if (marked (ilit) > 0)
+        continue; // Duplicated literal.
+      else if (marked (ilit) < 0)
+        ignore = true; // Tautological clause.
+      else
+        mark (ilit), clause.push_back (ilit);
+    }
+    for (const auto &lit : clause)
+      unmark (lit);
+    if (ignore || unsat) {
+      LOG ("ignoring imported clause");
+      stats.imported.ignored++;
+    } else {
+      stats.imported.clauses++;
+      const size_t size = clause.size ();
+      if (!size) {
+        LOG ("imported clause falsified on the root level");
+        learn_empty_clause ();
+      } else if (size == 1) {
+        LOG ("imported unit clause %d", clause[0]);
+        stats.imported.units++;
+        assign_unit (clause[0]);
+      } else {
+        Clause *c = new_clause (true, (int) size);
+        LOG (c, "imported");
+        watch_clause (c);
+      }
+    }
+    clause.clear ();
+  } while (!unsat && importer->importing ());
+  return true;
+}
+
+} // namespace CaDiCaL
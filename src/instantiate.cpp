@@ -82,6 +82,22 @@ bool Internal::inst_propagate () { // Adapted from 'propagate'.
   while (ok && propagated != trail.size ()) {
     const int lit = -trail[propagated++];
     LOG ("instantiate propagating %d", -lit);
+    for (const auto &w : bwatches (lit)) {
+      const signed char b = val (w.blit);
+      if (b > 0)
+        continue;
+      if (lrat) {
+        inst_chain.push_back (watched (w));
+      }
+      if (b < 0) {
+        ok = false;
+        LOG (watched (w), "conflict");
+        break;
+      }
+      inst_assign (w.blit);
+    }
+    if (!ok)
+      break;
     Watches &ws = watches (lit);
     const const_watch_iterator eow = ws.end ();
     const_watch_iterator i = ws.begin ();
@@ -91,68 +107,52 @@ bool Internal::inst_propagate () { // Adapted from 'propagate'.
       const signed char b = val (w.blit);
       if (b > 0)
         continue;
-      if (w.binary ()) {
-        if (b < 0) {
-          ok = false;
-          LOG (w.clause, "conflict");
+      literal_iterator lits = watched (w)->begin ();
+      const int other = lits[0] ^ lits[1] ^ lit;
+      lits[0] = other, lits[1] = lit;
+      const signed char u = val (other);
+      if (u > 0)
+        j[-1].blit = other;
+      else {
+        const int size = watched (w)->size;
+        const const_literal_iterator end = lits + size;
+        const literal_iterator middle = lits + watched (w)->pos;
+        literal_iterator k = middle;
+        signed char v = -1;
+        int r = 0;
+        while (k != end && (v = val (r = *k)) < 0)
+          k++;
+        if (v < 0) {
+          k = lits + 2;
+          assert (watched (w)->pos <= size);
+          while (k != middle && (v = val (r = *k)) < 0)
+            k++;
+        }
+        watched (w)->pos = k - lits;
+        assert (lits + 2 <= k), assert (k <= watched (w)->end ());
+        if (v > 0) {
+          j[-1].blit = r;
+        } else if (!v) {
+          LOG (watched (w), "unwatch %d in", r);
+          lits[1] = r;
+          *k = lit;
+          watch_literal (r, lit, watched (w));
+          j--;
+        } else if (!u) {
+          assert (v < 0);
           if (lrat) {
-            inst_chain.push_back (w.clause);
+            inst_chain.push_back (watched (w));
           }
-          break;
+          inst_assign (other);
         } else {
+          assert (u < 0);
+          assert (v < 0);
           if (lrat) {
-            inst_chain.push_back (w.clause);
-          }
-          inst_assign (w.blit);
-        }
-      } else {
-        literal_iterator lits = w.clause->begin ();
-        const int other = lits[0] ^ lits[1] ^ lit;
-        lits[0] = other, lits[1] = lit;
-        const signed char u = val (other);
-        if (u > 0)
-          j[-1].blit = other;
-        else {
-          const int size = w.clause->size;
-          const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
-          literal_iterator k = middle;
-          signed char v = -1;
-          int r = 0;
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
-          if (v < 0) {
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
-          if (v > 0) {
-            j[-1].blit = r;
-          } else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
-            lits[1] = r;
-            *k = lit;
-            watch_literal (r, lit, w.clause);
-            j--;
-          } else if (!u) {
-            assert (v < 0);
-            if (lrat) {
-              inst_chain.push_back (w.clause);
-            }
-            inst_assign (other);
-          } else {
-            assert (u < 0);
-            assert (v < 0);
-            if (lrat) {
-              inst_chain.push_back (w.clause);
-            }
-            LOG (w.clause, "conflict");
-            ok = false;
-            break;
+            inst_chain.push_back (watched (w));
           }
+          LOG (watched (w), "conflict");
+          ok = false;
+          break;
         }
       }
     }
@@ -9,19 +9,21 @@ Internal::Internal ()
     : mode (SEARCH), unsat (false), iterating (false),
       localsearching (false), lookingahead (false), preprocessing (false),
       protected_reasons (false), force_saved_phase (false),
-      searching_lucky_phases (false), stable (false), reported (false),
+      searching_lucky_phases (false), stable (false), resuming (false),
+      reported (false),
       external_prop (false), did_external_prop (false),
-      external_prop_is_lazy (true), rephased (0), vsize (0), max_var (0),
+      external_prop_is_lazy (true), simd (simd_supported ()),
+      rephased (0), vsize (0), max_var (0),
       clause_id (0), original_id (0), reserved_ids (0), conflict_id (0),
       concluded (false), lrat (false), level (0), vals (0), score_inc (1.0),
-      scores (this), conflict (0), ignore (0),
+      scores (this), conflict (0), lowest_conflict (0), ignore (0),
       external_reason (&external_reason_clause), newest_clause (0),
       force_no_backtrack (false), from_propagator (false),
       tainted_literal (0), notified (0), probe_reason (0), propagated (0),
       propagated2 (0), propergated (0), best_assigned (0),
       target_assigned (0), no_conflict_until (0), unsat_constraint (false),
       marked_failed (true), multitrail_dirty (0), num_assigned (0),
-      proof (0), lratbuilder (0), opts (this),
+      proof (0), lratbuilder (0), walkers (0), opts (this),
 #ifndef QUIET
       profiles (this), force_phase_messages (false),
 #endif
@@ -32,6 +34,7 @@ Internal::Internal ()
 }
 
 Internal::~Internal () {
+  stop_walkers ();
   for (const auto &c : clauses)
     delete_clause (c);
   if (proof)
@@ -69,11 +72,14 @@ Internal::~Internal () {
 // by static analyzers though.  Clang with '--analyze' thought that this
 // idiom would generate a memory leak thus we use the following dummy.
 
+// The vectorized replacement search 'find_replacement_simd' loads four
+// values starting at 'vals[lit]' and thus we allocate three more bytes.
+
 static signed char *ignore_clang_analyze_memory_leak_warning;
 
 void Internal::enlarge_vals (size_t new_vsize) {
   signed char *new_vals;
-  const size_t bytes = 2u * new_vsize;
+  const size_t bytes = 2u * new_vsize + sizeof (int) - 1;
   new_vals = new signed char[bytes]; // g++-4.8 does not like ... { 0 };
   memset (new_vals, 0, bytes);
   ignore_clang_analyze_memory_leak_warning = new_vals;
@@ -114,6 +120,7 @@ void Internal::enlarge (int new_max_var) {
   // Ordered in the size of allocated memory (larger block first).
   enlarge_zero (unit_clauses, 2 * new_vsize);
   enlarge_only (wtab, 2 * new_vsize);
+  enlarge_only (bwtab, 2 * new_vsize);
   enlarge_only (vtab, new_vsize);
   enlarge_zero (parents, new_vsize);
   enlarge_only (links, new_vsize);
@@ -121,7 +128,9 @@ void Internal::enlarge (int new_max_var) {
   enlarge_zero (gtab, new_vsize);
   enlarge_zero (stab, new_vsize);
   enlarge_init (ptab, 2 * new_vsize, -1);
+#ifndef HOT_VARS
   enlarge_only (ftab, new_vsize);
+#endif
   enlarge_vals (new_vsize);
   enlarge_zero (frozentab, new_vsize);
   enlarge_zero (relevanttab, new_vsize);
@@ -218,6 +227,9 @@ int Internal::cdcl_loop_with_inprocessing () {
 
   START (search);
 
+  if (opts.walk && opts.walkthreads && !walkers)
+    start_walkers ();
+
   if (stable) {
     START (stable);
     report ('[');
@@ -233,6 +245,12 @@ int Internal::cdcl_loop_with_inprocessing () {
       res = 20;
     else if (!propagate ())
       analyze (); // propagate and analyze
+    else if (!gauss_propagate () || unsat) { // XOR propagation
+      if (unsat)
+        continue;
+      else
+        analyze ();
+    }
     else if (iterating)
       iterate ();                               // report learned unit
     else if (!external_propagate () || unsat) { // external propagation
@@ -248,8 +266,10 @@ int Internal::cdcl_loop_with_inprocessing () {
           analyze ();
       } else if (satisfied ())
         res = 10;
-    } else if (search_limits_hit ())
-      break;                               // decision or conflict limit
+    } else if (search_limits_hit ()) { // decision, conflict or ticks limit
+      resuming = ticks_limit_hit (); // only time slices are resumed
+      break;
+    }
     else if (terminated_asynchronously ()) // externally terminated
       break;
     else if (restarting ())
@@ -280,6 +300,8 @@ int Internal::cdcl_loop_with_inprocessing () {
     report ('}');
   }
 
+  stop_walkers ();
+
   STOP (search);
 
   return res;
@@ -331,10 +353,15 @@ void Internal::init_preprocessing_limits () {
   LOG ("%s elim limit %" PRId64 " after %" PRId64 " conflicts", mode,
        lim.elim, lim.elim - stats.conflicts);
 
-  // Initialize and reset elimination bounds in any case.
+  // Initialize and reset elimination bounds unless resuming a search
+  // stopped at the ticks limit (see 'init_search_limits').
 
-  lim.elimbound = opts.elimboundmin;
-  LOG ("elimination bound %" PRId64 "", lim.elimbound);
+  if (incremental && resuming)
+    LOG ("keeping elimination bound %" PRId64 "", lim.elimbound);
+  else {
+    lim.elimbound = opts.elimboundmin;
+    LOG ("elimination bound %" PRId64 "", lim.elimbound);
+  }
 
   /*----------------------------------------------------------------------*/
 
@@ -391,6 +418,16 @@ void Internal::init_search_limits () {
   else
     LOG ("initializing search limits and increments");
 
+  // If the last search stopped at the 'ticks' limit, which is used to
+  // solve in time slices, we resume it with the current restart, rephase
+  // and stabilization state instead of starting over.  Conflict and
+  // decision limits are rather used for bounded incremental calls, often
+  // with new clauses or assumptions in between, and thus start over.
+  //
+  const bool resume = incremental && resuming;
+  if (resume)
+    LOG ("resuming search stopped at ticks limit");
+
   const char *mode = 0;
 
   /*----------------------------------------------------------------------*/
@@ -421,20 +458,28 @@ void Internal::init_search_limits () {
 
   /*----------------------------------------------------------------------*/
 
-  // Initialize or reset 'rephase' limits in any case.
+  // Initialize or reset 'rephase' limits unless resuming.
 
-  lim.rephase = stats.conflicts + opts.rephaseint;
-  lim.rephased[0] = lim.rephased[1] = 0;
-  LOG ("new rephase limit %" PRId64 " after %" PRId64 " conflicts",
-       lim.rephase, lim.rephase - stats.conflicts);
+  if (resume)
+    LOG ("keeping rephase limit %" PRId64 "", lim.rephase);
+  else {
+    lim.rephase = stats.conflicts + opts.rephaseint;
+    lim.rephased[0] = lim.rephased[1] = 0;
+    LOG ("new rephase limit %" PRId64 " after %" PRId64 " conflicts",
+         lim.rephase, lim.rephase - stats.conflicts);
+  }
 
   /*----------------------------------------------------------------------*/
 
-  // Initialize or reset 'restart' limits in any case.
+  // Initialize or reset 'restart' limits unless resuming.
 
-  lim.restart = stats.conflicts + opts.restartint;
-  LOG ("new restart limit %" PRId64 " increment %" PRId64 "", lim.restart,
-       lim.restart - stats.conflicts);
+  if (resume)
+    LOG ("keeping restart limit %" PRId64 "", lim.restart);
+  else {
+    lim.restart = stats.conflicts + opts.restartint;
+    LOG ("new restart limit %" PRId64 " increment %" PRId64 "",
+         lim.restart, lim.restart - stats.conflicts);
+  }
 
   /*----------------------------------------------------------------------*/
 
@@ -448,6 +493,8 @@ void Internal::init_search_limits () {
   } else if (opts.stabilize && opts.stabilizeonly) {
     LOG ("keeping always forced stable phase");
     assert (stable);
+  } else if (resume && (!stable || opts.stabilize)) {
+    LOG ("keeping %s phase", stable ? "stable" : "non-stable");
   } else if (stable) {
     LOG ("switching back to default non-stable phase");
     stable = false;
@@ -455,21 +502,26 @@ void Internal::init_search_limits () {
   } else
     LOG ("keeping non-stable phase");
 
-  inc.stabilize = opts.stabilizeint;
-  lim.stabilize = stats.conflicts + inc.stabilize;
-  LOG ("new stabilize limit %" PRId64 " after %" PRId64 " conflicts",
-       lim.stabilize, inc.stabilize);
-
-  if (opts.stabilize && opts.reluctant) {
-    LOG ("new restart reluctant doubling sequence period %d",
-         opts.reluctant);
-    reluctant.enable (opts.reluctant, opts.reluctantmax);
-  } else
-    reluctant.disable ();
+  if (resume)
+    LOG ("keeping stabilize limit %" PRId64 " and reluctant doubling",
+         lim.stabilize);
+  else {
+    inc.stabilize = opts.stabilizeint;
+    lim.stabilize = stats.conflicts + inc.stabilize;
+    LOG ("new stabilize limit %" PRId64 " after %" PRId64 " conflicts",
+         lim.stabilize, inc.stabilize);
+
+    if (opts.stabilize && opts.reluctant) {
+      LOG ("new restart reluctant doubling sequence period %d",
+           opts.reluctant);
+      reluctant.enable (opts.reluctant, opts.reluctantmax);
+    } else
+      reluctant.disable ();
+  }
 
   /*----------------------------------------------------------------------*/
 
-  // Conflict and decision limits.
+  // Conflict, decision and ticks limits.
 
   if (inc.conflicts < 0) {
     lim.conflicts = -1;
@@ -491,6 +543,15 @@ void Internal::init_search_limits () {
          inc.decisions, lim.decisions);
   }
 
+  if (inc.ticks < 0) {
+    lim.ticks = -1;
+    LOG ("no limit on ticks");
+  } else {
+    lim.ticks = stats.all_ticks () + inc.ticks;
+    LOG ("ticks limit after %" PRId64 " ticks at %" PRId64 " ticks",
+         inc.ticks, lim.ticks);
+  }
+
   /*----------------------------------------------------------------------*/
 
   // Initial preprocessing rounds.
@@ -628,7 +689,7 @@ int Internal::local_search_round (int round) {
   assert (!localsearching);
   localsearching = true;
 
-  // Determine propagation limit quadratically scaled with rounds.
+  // Determine ticks limit quadratically scaled with rounds.
   //
   int64_t limit = opts.walkmineff;
   limit *= round;
@@ -711,16 +772,19 @@ int Internal::solve (bool preprocess_only) {
     res = restore_clauses ();
   if (!res) {
     init_preprocessing_limits ();
-    if (!preprocess_only)
+    if (!preprocess_only) {
       init_search_limits ();
+      reshape_scores ();
+    }
   }
   if (!res && !level)
     res = preprocess ();
   if (!preprocess_only) {
     if (!res && !level)
       res = local_search ();
-    if (!res && !level)
+    if (!res && !level && !resuming)
       res = lucky_phases ();
+    resuming = false;
     if (!res || (res == 10 && external_prop)) {
       if (res == 10 && external_prop && level)
         backtrack ();
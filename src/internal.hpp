@@ -50,6 +50,7 @@ extern "C" {
 #include "averages.hpp"
 #include "bins.hpp"
 #include "block.hpp"
+#include "bva.hpp"
 #include "cadical.hpp"
 #include "checker.hpp"
 #include "clause.hpp"
@@ -65,6 +66,7 @@ extern "C" {
 #include "flags.hpp"
 #include "format.hpp"
 #include "frattracer.hpp"
+#include "gauss.hpp"
 #include "heap.hpp"
 #include "idruptracer.hpp"
 #include "instantiate.hpp"
@@ -89,15 +91,18 @@ extern "C" {
 #include "reap.hpp"
 #include "reluctant.hpp"
 #include "resources.hpp"
+#include "saved.hpp"
 #include "score.hpp"
 #include "stats.hpp"
 #include "terminal.hpp"
 #include "tracer.hpp"
+#include "trails.hpp"
 #include "util.hpp"
 #include "var.hpp"
 #include "veripbtracer.hpp"
 #include "version.hpp"
 #include "vivify.hpp"
+#include "walkers.hpp"
 #include "watch.hpp"
 
 /*------------------------------------------------------------------------*/
@@ -109,6 +114,9 @@ using namespace std;
 struct Coveror;
 struct External;
 struct Walker;
+struct Walkers;
+struct Subsumers;
+struct Eliminators;
 class Tracer;
 class FileTracer;
 class StatTracer;
@@ -129,20 +137,21 @@ struct Internal {
 
   enum Mode {
     BLOCK = (1 << 0),
-    CONDITION = (1 << 1),
-    COVER = (1 << 2),
-    DECOMP = (1 << 3),
-    DEDUP = (1 << 4),
-    ELIM = (1 << 5),
-    LUCKY = (1 << 6),
-    PROBE = (1 << 7),
-    SEARCH = (1 << 8),
-    SIMPLIFY = (1 << 9),
-    SUBSUME = (1 << 10),
-    TERNARY = (1 << 11),
-    TRANSRED = (1 << 12),
-    VIVIFY = (1 << 13),
-    WALK = (1 << 14),
+    BVA = (1 << 1),
+    CONDITION = (1 << 2),
+    COVER = (1 << 3),
+    DECOMP = (1 << 4),
+    DEDUP = (1 << 5),
+    ELIM = (1 << 6),
+    LUCKY = (1 << 7),
+    PROBE = (1 << 8),
+    SEARCH = (1 << 9),
+    SIMPLIFY = (1 << 10),
+    SUBSUME = (1 << 11),
+    TERNARY = (1 << 12),
+    TRANSRED = (1 << 13),
+    VIVIFY = (1 << 14),
+    WALK = (1 << 15),
   };
 
   bool in_mode (Mode m) const { return (mode & m) != 0; }
@@ -168,10 +177,12 @@ struct Internal {
   bool force_saved_phase;      // force saved phase in decision
   bool searching_lucky_phases; // during 'lucky_phases'
   bool stable;                 // true during stabilization phase
+  bool resuming;               // last search stopped at ticks limit
   bool reported;               // reported in this solving call
   bool external_prop;         // true if an external propagator is connected
   bool did_external_prop;     // true if ext. propagation happened
   bool external_prop_is_lazy; // true if the external propagator is lazy
+  bool simd;                  // vectorized replacement search supported
   char rephased;              // last type of resetting phases
   Reluctant reluctant;        // restart counter in stable mode
   size_t vsize;               // actually allocated variable data size
@@ -205,7 +216,9 @@ struct Internal {
   vector<double> stab;          // table of variable scores [1,max_var]
   vector<Var> vtab;             // variable table [1,max_var]
   vector<int> parents;          // parent literals during probing
+#ifndef HOT_VARS
   vector<Flags> ftab;           // variable and literal flags
+#endif
   vector<int64_t> btab;         // enqueue time stamps for queue
   vector<int64_t> gtab;         // time stamp table to recompute glue
   vector<Occs> otab;            // table of occurrences for all literals
@@ -213,8 +226,12 @@ struct Internal {
   vector<int64_t> ntab;         // number of one-sided occurrences table
   vector<Bins> big;             // binary implication graph
   vector<Watches> wtab;         // table of watches for all literals
+  vector<Watches> bwtab;        // table of binary watches for all literals
   Clause *conflict;             // set in 'propagation', reset in 'analyze'
   vector<Clause *> conflicts;   // set in propagate for opts.reimply
+  vector<int> conflict_levels;  // conflicting levels of 'conflicts'
+  vector<vector<unsigned>> conflict_buckets; // 'conflicts' by level
+  size_t lowest_conflict;       // first conflict with lowest level
   Clause *ignore;               // ignored during 'vivify_propagate'
   Clause *external_reason;      // used as reason at external propagations
   Clause *newest_clause;        // used in external_propagate
@@ -247,8 +264,9 @@ struct Internal {
   Reap reap;                 // radix heap for shrink
 
   int multitrail_dirty;
-  vector<size_t> multitrail;  // "propagated" for each level
-  vector<vector<int>> trails; // all assignments on all levels
+  Trails trails;              // all assignments on all levels
+  SavedTrail saved_trail;     // undone at last back-jump
+  Gauss gauss;                // XOR rows for Gauss-Jordan propagation
   size_t num_assigned;        // check for satisfied
 
   vector<int> probes;       // remaining scheduled probes
@@ -261,6 +279,7 @@ struct Internal {
 
   Proof *proof;             // abstraction layer between solver and tracers
   LratBuilder *lratbuilder; // special proof tracer
+  Walkers *walkers;         // background local search threads
   vector<Tracer *>
       tracers; // proof tracing objects (ie interpolant calulator)
   vector<FileTracer *>
@@ -388,12 +407,20 @@ struct Internal {
   //
   Var &var (int lit) { return vtab[vidx (lit)]; }
   Link &link (int lit) { return links[vidx (lit)]; }
+#ifdef HOT_VARS
+  Flags &flags (int lit) { return vtab[vidx (lit)].flags; }
+#else
   Flags &flags (int lit) { return ftab[vidx (lit)]; }
+#endif
   int64_t &bumped (int lit) { return btab[vidx (lit)]; }
   int &propfixed (int lit) { return ptab[vlit (lit)]; }
   double &score (int lit) { return stab[vidx (lit)]; }
 
+#ifdef HOT_VARS
+  const Flags &flags (int lit) const { return vtab[vidx (lit)].flags; }
+#else
   const Flags &flags (int lit) const { return ftab[vidx (lit)]; }
+#endif
 
   bool occurring () const { return !otab.empty (); }
   bool watching () const { return !wtab.empty (); }
@@ -402,6 +429,7 @@ struct Internal {
   Occs &occs (int lit) { return otab[vlit (lit)]; }
   int64_t &noccs (int lit) { return ntab[vlit (lit)]; }
   Watches &watches (int lit) { return wtab[vlit (lit)]; }
+  Watches &bwatches (int lit) { return bwtab[vlit (lit)]; }
 
   // Variable bumping through exponential VSIDS (EVSIDS) as in MiniSAT.
   //
@@ -508,16 +536,70 @@ struct Internal {
   void unmark_clause (); // unmark 'this->clause'
   void unmark (Clause *);
 
+  // The clause of a watch and a new watch of a clause with blocking
+  // literal 'blit', independent of whether watches are compact (in which
+  // case they refer to clauses in the arena, see 'watch.hpp').
+  //
+#ifdef COMPACT_WATCHES
+  Clause *watched (const Watch &w) const {
+    return arena.clause (w.reference ());
+  }
+  Watch make_watch (int blit, Clause *c) const {
+    return Watch (blit, arena.reference (c), c->size == 2);
+  }
+#else
+  Clause *watched (const Watch &w) const { return w.clause; }
+  Watch make_watch (int blit, Clause *c) const { return Watch (blit, c); }
+#endif
+
+  // Binary clauses are watched in separate watch lists 'bwatches', which
+  // only contain binary watches, while 'watches' only contains watches of
+  // larger clauses.  Thus the list of a watch is determined by the size of
+  // its clause.  If a watched clause is shrunken to a binary clause its
+  // watches have to be moved with 'update_watch_size'.
+
   // Watch literal 'lit' in clause with blocking literal 'blit'.
   // Inlined here, since it occurs in the tight inner loop of 'propagate'.
   //
   inline void watch_literal (int lit, int blit, Clause *c) {
     assert (lit != blit);
-    Watches &ws = watches (lit);
-    ws.push_back (Watch (blit, c));
+    const Watch w = make_watch (blit, c);
+    Watches &ws = w.binary () ? bwatches (lit) : watches (lit);
+    ws.push_back (w);
     LOG (c, "watch %d blit %d in", lit, blit);
   }
 
+  inline void remove_watch (Watches &ws, Clause *clause) {
+    const auto end = ws.end ();
+    auto i = ws.begin ();
+    for (auto j = i; j != end; j++) {
+      const Watch &w = *i++ = *j;
+      if (watched (w) == clause)
+        i--;
+    }
+    assert (i + 1 == end);
+    ws.resize (i - ws.begin ());
+  }
+
+  inline void unwatch_literal (int lit, Clause *c) {
+    remove_watch (c->size == 2 ? bwatches (lit) : watches (lit), c);
+  }
+
+  // search for the clause and updates the size marked in the watch lists
+  // (moving the watch to the binary watches if the clause became binary)
+  inline void update_watch_size (int lit, int blit, Clause *conflict) {
+    const Watch u = make_watch (blit, conflict);
+    Watches &ws = u.binary () ? bwatches (lit) : watches (lit);
+    for (Watch &w : ws)
+      if (watched (w) == conflict) {
+        w = u;
+        return;
+      }
+    assert (u.binary ());
+    remove_watch (watches (lit), conflict);
+    ws.push_back (u);
+  }
+
   // for debugging...
   // invariant from intel sat (see watch.hpp)
   // assert (val (lit) >= 0 ||
@@ -537,8 +619,8 @@ struct Internal {
   inline void unwatch_clause (Clause *c) {
     const int l0 = c->literals[0];
     const int l1 = c->literals[1];
-    remove_watch (watches (l0), c);
-    remove_watch (watches (l1), c);
+    unwatch_literal (l0, c);
+    unwatch_literal (l1, c);
   }
 
   // Update queue to point to last potentially still unassigned variable.
@@ -610,11 +692,16 @@ struct Internal {
   int assignment_level (int lit, Clause *);
   void build_chain_for_units (int lit, Clause *reason, bool forced);
   void build_chain_for_empty ();
+  template <bool with_lrat, bool with_external>
+  void search_assign (int lit, Clause *);
   void search_assign (int lit, Clause *);
   void search_assign_driving (int lit, Clause *reason);
   void search_assign_external (int lit);
   void search_assume_decision (int decision);
   void assign_unit (int lit);
+  template <bool with_lrat, bool with_external>
+  void replay_saved_trail (int replay_level);
+  template <bool with_lrat, bool with_external> bool propagate_kernel ();
   bool propagate ();
 
   void propergate (); // Repropagate without blocking literals.
@@ -625,6 +712,7 @@ struct Internal {
   void unassign (int lit);
   void update_target_and_best ();
   void backtrack (int target_level = 0);
+  void save_trail (int new_level);
 
   // Minimized learned clauses in 'minimize.cpp'.
   //
@@ -691,6 +779,19 @@ struct Internal {
   void set_tainted_literal ();
   void connect_propagator ();
 
+  // Gauss-Jordan elimination on XOR constraints in 'gauss.cpp'.
+  //
+  bool gauss_enabled ();
+  bool gauss_valid ();
+  void gauss_unwatch (unsigned row, int idx);
+  void gauss_find_xors (vector<int> &vars, vector<GaussXor> &xors);
+  bool gauss_eliminate (GaussMatrix &, vector<uint64_t> &bits,
+                        vector<char> &rhs, vector<int> &units);
+  void gauss_extract ();
+  Clause *gauss_new_clause (const GaussRow &, int lit);
+  void gauss_propagate_literal (int lit);
+  bool gauss_propagate ();
+
   // Use last learned clause to subsume some more.
   //
   void eagerly_subsume_recently_learned_clauses (Clause *);
@@ -702,6 +803,10 @@ struct Internal {
   int reuse_trail ();
   void restart ();
 
+  // Importing clauses from a connected importer in 'import.cpp'.
+  //
+  bool import_clauses ();
+
   // Functions to set and reset certain 'phases'.
   //
   void clear_phases (vector<signed char> &); // reset argument to zero
@@ -717,6 +822,7 @@ struct Internal {
   char rephase_random ();
   char rephase_walk ();
   void shuffle_scores ();
+  void reshape_scores ();
   void shuffle_queue ();
   void rephase ();
 
@@ -731,12 +837,14 @@ struct Internal {
   int backward_true_satisfiable ();
   int positive_horn_satisfiable ();
   int negative_horn_satisfiable ();
+  int parallel_lucky_phases ();
 
   // Asynchronous terminating check.
   //
   bool terminated_asynchronously (int factor = 1);
 
   bool search_limits_hit ();
+  bool ticks_limit_hit ();
 
   void terminate () {
     LOG ("forcing asynchronous termination");
@@ -763,7 +871,8 @@ struct Internal {
   void remove_falsified_literals (Clause *);
   void mark_satisfied_clauses_as_garbage ();
   void copy_clause (Clause *);
-  void flush_watches (int lit, Watches &);
+  void copy_watched_clauses (int lit);
+  void flush_watches (int lit);
   size_t flush_occs (int lit);
   void flush_all_occs_and_watches ();
   void update_reason_references ();
@@ -773,6 +882,8 @@ struct Internal {
   void check_var_stats ();
   bool arenaing ();
   void garbage_collection ();
+  bool selective_collecting ();
+  void selective_collection ();
 
   // Set-up occurrence list counters and containers.
   //
@@ -787,7 +898,6 @@ struct Internal {
   //
   void init_watches ();
   void connect_watches (bool irredundant_only = false);
-  void sort_watches ();
   void clear_watches ();
   void reset_watches ();
 
@@ -797,7 +907,13 @@ struct Internal {
   void strengthen_clause (Clause *, int);
   void subsume_clause (Clause *subsuming, Clause *subsumed);
   int subsume_check (Clause *subsuming, Clause *subsumed);
-  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken);
+  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken,
+                             vector<Sigs> &);
+  int subsume_or_strengthen (Clause *, Clause *, int flipped,
+                             vector<Clause *> &shrunken);
+  int try_to_subsume_clause_in_parallel (Subsumers &, size_t,
+                                         vector<Clause *> &shrunken,
+                                         vector<Sigs> &);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume (bool update_limits = true);
@@ -983,6 +1099,17 @@ struct Internal {
   void block_literal (Blocker &, int lit);
   bool block ();
 
+  // Bounded variable addition in 'bva.cpp'.
+  //
+  void bva_schedule (Factorizer &);
+  void bva_connect_clause (Factorizer &, Clause *);
+  void bva_remove_clause (Factorizer &, Clause *);
+  bool bva_match_literal (Factorizer &, int lit);
+  void bva_add_clauses (Factorizer &, int idx);
+  void bva_literal (Factorizer &, int lit);
+  void bva ();
+  void rename_introduced_in_proof (int from, int to, int idx);
+
   // Find gates in 'gates.cpp' for bounded variable substitution.
   //
   int second_literal_in_binary_clause_lrat (Clause *, int first);
@@ -1024,7 +1151,10 @@ struct Internal {
   void elim_propagate (Eliminator &, int unit);
   void elim_on_the_fly_self_subsumption (Eliminator &, Clause *, int);
   void try_to_eliminate_variable (Eliminator &, int pivot);
+  int64_t try_to_eliminate_variables_in_parallel (Eliminator &,
+                                                  Eliminators &);
   void increase_elimination_bound ();
+  int64_t elimination_bound (int pivot);
   int elim_round (bool &completed);
   void elim (bool update_limits = true);
 
@@ -1042,19 +1172,40 @@ struct Internal {
   void new_trail_level (int lit);
   void clear_trails (int level);
   void multi_backtrack (int new_level);
-  int trail_size (int l);
   int trails_sizes (int l);
   void trail_push (int lit, int l);
+
+  // Size of the trail of level 'l' and literal at position 'i' on it.
+  // Without 'opts.reimply' (or for 'l == 0') this is the classic 'trail'.
+  // Both are inlined here since they occur in 'propagate' and 'analyze'.
+  //
+  int trail_size (int l) {
+    if (!opts.reimply || l <= 0)
+      return (int) trail.size ();
+    return (int) trails.segment (l).size;
+  }
+  int &trail_lit (int l, int i) {
+    if (!opts.reimply || l <= 0) {
+      assert ((size_t) i < trail.size ());
+      return trail[i];
+    }
+    return trails.lit (l, i);
+  }
+
   int next_propagation_level (int last);
-  vector<int> *next_trail (int l);
   int next_propagated (int l);
   Clause *propagation_conflict (int l, Clause *c);
   int conflicting_level (Clause *c);
+  void push_conflict_level (size_t i);
+  void update_conflict_levels (int old_level);
+  void clear_conflict_levels ();
   void elevate_lit (int lit, Clause *reason);
   int elevating_level (int lit, Clause *reason);
   void set_propagated (int l, int prop);
   bool propagate_conflicts ();
   bool propagate_multitrail ();
+  template <bool with_lrat, bool with_external>
+  bool propagate_clean_kernel ();
   bool propagate_clean ();
 
   // Hyper ternary resolution.
@@ -1090,6 +1241,7 @@ struct Internal {
   void probe_propagate2 ();
   bool probe_propagate ();
   bool is_binary_clause (Clause *c, int &, int &);
+  void probe_bits (int64_t limit);
   void generate_probes ();
   void flush_probes ();
   int next_probe ();
@@ -1100,12 +1252,20 @@ struct Internal {
   //
   void walk_save_minimum (Walker &);
   Clause *walk_pick_clause (Walker &);
-  unsigned walk_break_value (int lit);
+  unsigned walk_break_value (int lit, int64_t &ticks);
   int walk_pick_lit (Walker &, Clause *);
   void walk_flip_lit (Walker &, int lit);
+  void walk_init_cache (Walker &);
+  void walk_flip_cached_lit (Walker &, int lit);
   int walk_round (int64_t limit, bool prev);
   void walk ();
 
+  // Background local search threads in 'walkers.cpp'.
+  //
+  void start_walkers ();
+  void stop_walkers ();
+  void restart_walkers ();
+
   // Detect strongly connected components in the binary implication graph
   // (BIG) and equivalent literal substitution (ELS) in 'decompose.cpp'.
   //
@@ -1187,6 +1347,7 @@ struct Internal {
   void limit_terminate (int);
   void limit_decisions (int);     // Force decision limit.
   void limit_conflicts (int);     // Force conflict limit.
+  void limit_ticks (int);         // Force ticks limit.
   void limit_preprocessing (int); // Enable 'n' preprocessing rounds.
   void limit_local_search (int);  // Enable 'n' local search rounds.
 
@@ -1270,6 +1431,22 @@ struct Internal {
     return vals[lit];
   }
 
+  // Find the first literal in '[k,end)' which is not assigned to false (or
+  // return 'end') while searching for a replacement watch in propagation.
+  // For long ranges we use a vectorized version if the CPU supports it.
+  //
+  static bool simd_supported ();
+  literal_iterator find_replacement_simd (literal_iterator k,
+                                          const_literal_iterator end);
+  literal_iterator find_replacement (literal_iterator k,
+                                     const_literal_iterator end) {
+    if (end - k >= 8 && simd && opts.simd)
+      return find_replacement_simd (k, end);
+    while (k != end && val (*k) < 0)
+      k++;
+    return k;
+  }
+
   // As suggested by Matt Ginsberg it might be useful to factor-out a common
   // setter function for setting and resetting the value of a literal.
   //
@@ -1582,9 +1759,18 @@ inline bool Internal::search_limits_hit () {
     return true;
   }
 
+  if (ticks_limit_hit ()) {
+    LOG ("ticks limit %" PRId64 " reached", lim.ticks);
+    return true;
+  }
+
   return false;
 }
 
+inline bool Internal::ticks_limit_hit () {
+  return lim.ticks >= 0 && stats.all_ticks () >= lim.ticks;
+}
+
 /*------------------------------------------------------------------------*/
 
 } // namespace CaDiCaL
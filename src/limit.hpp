@@ -11,6 +11,7 @@ struct Limit {
   int64_t decisions;     // decision limit if non-negative
   int64_t preprocessing; // limit on preprocessing rounds
   int64_t localsearch;   // limit on local search rounds
+  int64_t ticks;         // ticks limit if non-negative
 
   int64_t compact;   // conflict limit for next 'compact'
   int64_t condition; // conflict limit for next 'condition'
@@ -45,17 +46,24 @@ struct Limit {
 
 struct Last {
   struct {
-    int64_t propagations;
+    int64_t ticks;
   } transred, vivify;
   struct {
     int64_t fixed, subsumephases, marked;
   } elim;
   struct {
-    int64_t propagations, reductions;
+    int64_t ticks, reductions;
   } probe;
   struct {
     int64_t conflicts;
   } reduce, rephase;
+  struct {
+    int64_t added;
+    bool ignored; // due to proofs (reported once)
+  } bva;
+  struct {
+    int64_t added, inactive, compacts;
+  } gauss;
   struct {
     int64_t marked;
   } ternary;
@@ -72,6 +80,7 @@ struct Inc {
   int64_t decisions;     // next decision limit if non-negative
   int64_t preprocessing; // next preprocessing limit if non-negative
   int64_t localsearch;   // next local search limit if non-negative
+  int64_t ticks;         // next ticks limit if non-negative
   Inc ();
 };
 
@@ -378,8 +378,7 @@ int Internal::lookahead_probing () {
       MSG ("propagating units after probing results in empty clause");
       learn_empty_clause ();
       res = INT_MIN;
-    } else
-      sort_watches ();
+    }
   }
 
 #ifndef QUIET
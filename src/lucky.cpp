@@ -1,5 +1,9 @@
 #include "internal.hpp"
 
+#ifndef NTHREADS
+#include <chrono>
+#endif
+
 namespace CaDiCaL {
 
 // It turns out that even in the competition there are formulas which are
@@ -333,6 +337,303 @@ int Internal::negative_horn_satisfiable () {
   return 10;
 }
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+/*------------------------------------------------------------------------*/
+
+// With 'opts.luckythreads' the eight lucky strategies above are tried
+// concurrently by background threads before search.  All threads share a
+// read-only snapshot of the clauses with full occurrence lists and each
+// thread propagates its own assignment by counting true and false literals
+// in clauses.  Since no strategy ever backtracks, this counting propagation
+// is linear in the size of the formula, as watches would be, and computes
+// the same propagation closure.  A thread only records the decisions of its
+// strategy.  The decisions of the first successful strategy (in the order
+// of the sequential 'lucky_phases') are then replayed on the main thread,
+// which thus ends up with the same satisfying assignment.
+
+struct Luckies {
+
+  static const int strategies = 8;
+
+  int max_var;
+  size_t irredundant;               // irredundant clauses come first
+  std::vector<int> lits;            // zero terminated snapshot clauses
+  std::vector<unsigned> clauses;    // start of clause in 'lits'
+  std::vector<unsigned> offsets;    // occurrences of literal
+  std::vector<unsigned> occurrences;
+  std::vector<signed char> fixed;   // root level assignment
+
+  std::atomic<int> next;            // next strategy to try
+  std::atomic<int> winner;          // first successful strategy
+  std::atomic<int> finished;        // number of finished threads
+  std::atomic<bool> terminating;    // asynchronous termination
+  std::vector<int> decisions[strategies];
+
+  Luckies (Internal *);
+  bool satisfiable (int strategy, std::vector<int> &decisions);
+  void run ();
+
+  static unsigned vlit (int lit) {
+    return (lit < 0) + 2u * (unsigned) abs (lit);
+  }
+};
+
+// Snapshot of all clauses with root level satisfied clauses and falsified
+// literals removed, first the irredundant then the redundant clauses.
+// Redundant clauses are needed in order to compute the same propagation
+// closure as 'propagate' on the main thread during the replay.
+
+Luckies::Luckies (Internal *internal)
+    : max_var (internal->max_var), irredundant (0), next (0),
+      winner (strategies), finished (0), terminating (false) {
+  for (int redundant = 0; redundant < 2; redundant++) {
+    for (const auto &c : internal->clauses) {
+      if (c->garbage || c->redundant != (bool) redundant)
+        continue;
+      const size_t size = lits.size ();
+      bool satisfied = false;
+      for (const auto lit : *c) {
+        const int tmp = internal->fixed (lit);
+        if (tmp > 0) {
+          satisfied = true;
+          break;
+        }
+        if (!tmp)
+          lits.push_back (lit);
+      }
+      if (satisfied)
+        lits.resize (size);
+      else
+        clauses.push_back (size), lits.push_back (0);
+    }
+    if (!redundant)
+      irredundant = clauses.size ();
+  }
+  const size_t size = 2 * (max_var + 1) + 1;
+  offsets.resize (size);
+  for (const auto lit : lits)
+    if (lit)
+      offsets[vlit (lit) + 1]++;
+  for (size_t i = 1; i < size; i++)
+    offsets[i] += offsets[i - 1];
+  occurrences.resize (offsets.back ());
+  std::vector<unsigned> pos (offsets.begin (), offsets.end () - 1);
+  for (size_t i = 0; i < clauses.size (); i++)
+    for (const int *p = &lits[clauses[i]]; *p; p++)
+      occurrences[pos[vlit (*p)]++] = i;
+  fixed.resize (max_var + 1);
+  for (int idx = 1; idx <= max_var; idx++)
+    fixed[idx] = internal->fixed (idx);
+}
+
+// Run one strategy (numbered as in 'lucky_phases') on a local assignment
+// and return whether it satisfies the formula.  Strategies are aborted
+// early if an earlier one succeeded already.
+
+bool Luckies::satisfiable (int strategy, std::vector<int> &decided) {
+
+  const size_t nclauses = clauses.size ();
+  std::vector<signed char> values (fixed);
+  std::vector<unsigned> trues (nclauses), falses (nclauses);
+  std::vector<int> trail;
+  size_t propagated = 0;
+
+  const auto value = [&values] (int lit) {
+    const signed char tmp = values[abs (lit)];
+    return lit < 0 ? -tmp : tmp;
+  };
+  const auto assign = [&] (int lit) {
+    values[abs (lit)] = lit < 0 ? -1 : 1;
+    trail.push_back (lit);
+  };
+  const auto propagate = [&] () {
+    while (propagated != trail.size ()) {
+      const int lit = trail[propagated++];
+      const unsigned t = vlit (lit), f = vlit (-lit);
+      for (unsigned k = offsets[t]; k != offsets[t + 1]; k++)
+        trues[occurrences[k]]++;
+      for (unsigned k = offsets[f]; k != offsets[f + 1]; k++) {
+        const unsigned c = occurrences[k];
+        const unsigned count = ++falses[c];
+        if (trues[c])
+          continue;
+        const size_t end = c + 1 < nclauses ? clauses[c + 1] : lits.size ();
+        const unsigned size = end - clauses[c] - 1;
+        if (count == size)
+          return false;
+        if (count + 1 < size)
+          continue;
+        int unit = 0;
+        const int *p = &lits[clauses[c]];
+        for (; *p; p++) {
+          const signed char tmp = value (*p);
+          if (tmp > 0)
+            break;
+          if (!tmp)
+            unit = *p;
+        }
+        if (!*p && unit)
+          assign (unit);
+      }
+    }
+    return true;
+  };
+  const auto aborted = [&] () {
+    return terminating.load (std::memory_order_relaxed) ||
+           winner.load (std::memory_order_relaxed) < strategy;
+  };
+  const auto decide = [&] (int lit) {
+    if (value (lit))
+      return true;
+    decided.push_back (lit);
+    assign (lit);
+    return propagate ();
+  };
+
+  // The constant strategies first check that every irredundant clause
+  // contains a literal of the right sign (see 'trivially_..._satisfiable').
+  //
+  if (strategy < 2) {
+    const int sign = strategy ? 1 : -1;
+    for (size_t i = 0; i < irredundant; i++) {
+      const int *p = &lits[clauses[i]];
+      while (*p && sign * *p < 0)
+        p++;
+      if (!*p)
+        return false;
+    }
+  }
+
+  // The horn strategies first go over the irredundant clauses and assign
+  // the first unassigned literal of the right sign in clauses which are
+  // not satisfied yet (see '..._horn_satisfiable').
+  //
+  if (strategy >= 6) {
+    const int sign = strategy == 6 ? 1 : -1;
+    for (size_t i = 0; i < irredundant; i++) {
+      if (aborted ())
+        return false;
+      int lit = 0;
+      bool satisfied = false;
+      for (const int *p = &lits[clauses[i]]; *p; p++) {
+        const signed char tmp = value (*p);
+        if (tmp > 0) {
+          satisfied = true;
+          break;
+        }
+        if (tmp < 0 || sign * *p < 0)
+          continue;
+        lit = *p;
+        break;
+      }
+      if (satisfied)
+        continue;
+      if (!lit || !decide (lit))
+        return false;
+    }
+  }
+
+  // Then all remaining variables are assigned forward or backward.
+  //
+  static const signed char phase[strategies] = {-1, 1, 1, -1, -1, 1, -1, 1};
+  const bool backward = strategy == 4 || strategy == 5;
+  for (int i = 1; i <= max_var; i++) {
+    if (aborted ())
+      return false;
+    const int idx = backward ? max_var + 1 - i : i;
+    if (!decide (phase[strategy] * idx))
+      return false;
+  }
+
+  return true;
+}
+
+void Luckies::run () {
+  for (;;) {
+    const int strategy = next.fetch_add (1, std::memory_order_relaxed);
+    if (strategy >= strategies)
+      break;
+    if (winner.load (std::memory_order_relaxed) < strategy)
+      break;
+    if (!satisfiable (strategy, decisions[strategy]))
+      continue;
+    int previous = winner.load (std::memory_order_relaxed);
+    while (strategy < previous &&
+           !winner.compare_exchange_weak (previous, strategy))
+      ;
+  }
+  finished.fetch_add (1, std::memory_order_release);
+}
+
+// Start the threads, wait for them while checking for asynchronous
+// termination and replay the decisions of the first successful strategy.
+
+int Internal::parallel_lucky_phases () {
+
+  Luckies luckies (this);
+  const int threads =
+      min ((int) opts.luckythreads, (int) Luckies::strategies);
+  PHASE ("lucky", stats.lucky.tried,
+         "trying lucky strategies with %d threads on %zu literals",
+         threads, luckies.lits.size ());
+
+  vector<std::thread> running;
+  for (int i = 0; i < threads; i++)
+    running.push_back (std::thread (&Luckies::run, &luckies));
+  while (luckies.finished.load (std::memory_order_acquire) < threads) {
+    if (terminated_asynchronously ())
+      luckies.terminating.store (true, std::memory_order_relaxed);
+    std::this_thread::sleep_for (std::chrono::milliseconds (1));
+  }
+  for (auto &thread : running)
+    thread.join ();
+
+  if (luckies.terminating.load (std::memory_order_relaxed))
+    return -1;
+  const int strategy = luckies.winner.load (std::memory_order_relaxed);
+  if (strategy == Luckies::strategies)
+    return 0;
+
+  for (const auto lit : luckies.decisions[strategy]) {
+    const signed char tmp = val (lit);
+    if (tmp > 0)
+      continue;
+    if (tmp < 0)
+      return unlucky (0);
+    search_assume_decision (lit);
+    if (!propagate ())
+      return unlucky (0);
+  }
+  for (auto idx : vars)
+    if (!val (idx))
+      return unlucky (0);
+
+  static const char *names[Luckies::strategies] = {
+      "constant false", "constant true",  "forward true",  "forward false",
+      "backward false", "backward true", "positive horn", "negative horn"};
+  VERBOSE (1, "parallel %s lucky strategy satisfies formula",
+           names[strategy]);
+  assert (satisfied ());
+  int64_t *counters[Luckies::strategies] = {
+      &stats.lucky.constant.zero, &stats.lucky.constant.one,
+      &stats.lucky.forward.one,   &stats.lucky.forward.zero,
+      &stats.lucky.backward.zero, &stats.lucky.backward.one,
+      &stats.lucky.horn.positive, &stats.lucky.horn.negative};
+  (*counters[strategy])++;
+  return 10;
+}
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+int Internal::parallel_lucky_phases () { return 0; }
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
+
 /*------------------------------------------------------------------------*/
 
 int Internal::lucky_phases () {
@@ -353,21 +654,26 @@ int Internal::lucky_phases () {
   assert (!searching_lucky_phases);
   searching_lucky_phases = true;
   stats.lucky.tried++;
-  int res = trivially_false_satisfiable ();
-  if (!res)
-    res = trivially_true_satisfiable ();
-  if (!res)
-    res = forward_true_satisfiable ();
-  if (!res)
-    res = forward_false_satisfiable ();
-  if (!res)
-    res = backward_false_satisfiable ();
-  if (!res)
-    res = backward_true_satisfiable ();
-  if (!res)
-    res = positive_horn_satisfiable ();
-  if (!res)
-    res = negative_horn_satisfiable ();
+  int res;
+  if (opts.luckythreads)
+    res = parallel_lucky_phases ();
+  else {
+    res = trivially_false_satisfiable ();
+    if (!res)
+      res = trivially_true_satisfiable ();
+    if (!res)
+      res = forward_true_satisfiable ();
+    if (!res)
+      res = forward_false_satisfiable ();
+    if (!res)
+      res = backward_false_satisfiable ();
+    if (!res)
+      res = backward_true_satisfiable ();
+    if (!res)
+      res = positive_horn_satisfiable ();
+    if (!res)
+      res = negative_horn_satisfiable ();
+  }
   if (res < 0)
     assert (termination_forced), res = 0;
   if (res == 10)
@@ -602,6 +602,29 @@ public:
   }
 };
 
+// Clauses given through 'import' calls are buffered and handed out to the
+// solver only after their terminating zero was seen, which happens at the
+// next restart during the next 'solve' call.  The random generator only
+// imports copies of original clauses, since imported clauses have to be
+// implied by the formula.
+
+class MockImporter : public Importer {
+  std::vector<int> literals;
+  size_t completed = 0, next = 0;
+
+public:
+  void push (int lit) {
+    literals.push_back (lit);
+    if (!lit)
+      completed = literals.size ();
+  }
+  bool importing () { return next < completed; }
+  int import () {
+    assert (next < completed);
+    return literals[next++];
+  }
+};
+
 // This is the class for the Mobical application.
 
 class Mobical : public Handler {
@@ -619,6 +642,9 @@ class Mobical : public Handler {
   friend class MockPropagator;
   friend struct ConnectCall;
   friend struct DisconnectCall;
+  friend struct InitCall;
+  friend struct ResetCall;
+  friend struct ImportCall;
 
   /*----------------------------------------------------------------------*/
 
@@ -719,6 +745,13 @@ protected:
   MockPropagator
       *mock_pointer; // to be able to clean up withouth disconnect
 
+  MockImporter *mock_importer; // connected by the first 'import' call
+  void delete_mock_importer () {
+    if (mock_importer)
+      delete mock_importer;
+    mock_importer = 0;
+  }
+
 public:
   Mobical ();
   ~Mobical ();
@@ -886,12 +919,14 @@ struct Call {
     CONCLUDE = (1u << 31),
     DISCONNECT = ((uint64_t) 1 << 32),
 
+    IMPORT = ((uint64_t) 1 << 33),
+
     ALWAYS = VARS | ACTIVE | REDUNDANT | IRREDUNDANT | FREEZE | FROZEN |
              MELT | LIMIT | OPTIMIZE | DUMP | STATS | RESERVE | FIXED,
 
     CONFIG = INIT | SET | CONFIGURE | ALWAYS,
-    BEFORE =
-        ADD | CONSTRAIN | ASSUME | ALWAYS | DISCONNECT | CONNECT | OBSERVE,
+    BEFORE = ADD | CONSTRAIN | ASSUME | ALWAYS | DISCONNECT | CONNECT |
+             OBSERVE | IMPORT,
     PROCESS = SOLVE | SIMPLIFY | LOOKAHEAD | CUBING,
     DURING = LEMMA, // | CONTINUE,
     AFTER = VAL | FLIP | FAILED | CONCLUDE | ALWAYS,
@@ -951,7 +986,10 @@ static bool after_type (Call::Type t) {
 
 struct InitCall : public Call {
   InitCall () : Call (INIT) {}
-  void execute (Solver *&s) { s = new Solver (); }
+  void execute (Solver *&s) {
+    mobical.delete_mock_importer ();
+    s = new Solver ();
+  }
   void print (ostream &o) { o << "init" << endl; }
   Call *copy () { return new InitCall (); }
   const char *keyword () { return "init"; }
@@ -1034,6 +1072,7 @@ struct ResetCall : public Call {
   void execute (Solver *&s) {
     delete s;
     s = 0;
+    mobical.delete_mock_importer ();
   }
   void print (ostream &o) { o << "reset" << endl; }
   Call *copy () { return new ResetCall (); }
@@ -1056,6 +1095,20 @@ struct ConstrainCall : public Call {
   const char *keyword () { return "constrain"; }
 };
 
+struct ImportCall : public Call {
+  ImportCall (int l) : Call (IMPORT, l) {}
+  void execute (Solver *&s) {
+    if (!mobical.mock_importer) {
+      mobical.mock_importer = new MockImporter ();
+      s->connect_importer (mobical.mock_importer);
+    }
+    mobical.mock_importer->push (arg);
+  }
+  void print (ostream &o) { o << "import " << arg << endl; }
+  Call *copy () { return new ImportCall (arg); }
+  const char *keyword () { return "import"; }
+};
+
 struct ConnectCall : public Call {
   ConnectCall () : Call (CONNECT) {}
   void execute (Solver *&s) {
@@ -1359,21 +1412,26 @@ public:
   void execute () {
     executed++;
     bool first = true;
+    size_t imported = 0;
     for (size_t i = 0; i < calls.size (); i++) {
       Call *c = calls[i];
       // They are (ideally) are executed already
       if (c->type == Call::LEMMA)
         continue;
+      if (c->type == Call::IMPORT && i < imported)
+        continue;
       // if (c->type == Call::CONTINUE)
       //   continue;
 
       if (c->type == Call::SOLVE) {
-        // Look ahead and collect LemmaCalls to be executed
-        // before solve is executed
+        // Look ahead and collect LemmaCalls and ImportCalls (traced during
+        // solving) to be executed before solve is executed
         for (size_t j = i + 1; j < calls.size (); j++) {
           Call *next_c = calls[j];
           if (next_c->type == Call::LEMMA)
             next_c->execute (solver);
+          else if (next_c->type == Call::IMPORT)
+            next_c->execute (solver), imported = j + 1;
           // else if (next_c->type == Call::CONTINUE)
           //   next_c->execute (solver);
           else
@@ -1509,6 +1567,7 @@ private:
   void generate_freeze (Random &, int vars);
   void generate_melt (Random &);
 
+  void generate_import (Random &);
   void generate_propagator (Random &, int minvars, int maxvars);
   void generate_lemmas (Random &);
 
@@ -1646,6 +1705,8 @@ int64_t Trace::option_high_value (const char *name, int64_t def, int64_t lo,
     return def;
   if (!strcmp (name, "walkmineff"))
     return def;
+  if (!strcmp (name, "walkthreads"))
+    return 2;
   if (!strcmp (name, "elimboundmax"))
     return 256;
   if (!strcmp (name, "elimboundmin"))
@@ -1783,6 +1844,8 @@ void Trace::generate_limits (Random &random) {
     push_back (new LimitCall ("conflicts", random.pick_log (0, 1e4)));
   if (random.generate_double () < 0.05)
     push_back (new LimitCall ("decisions", random.pick_log (0, 1e4)));
+  if (random.generate_double () < 0.05)
+    push_back (new LimitCall ("ticks", random.pick_log (0, 1e6)));
   if (random.generate_double () < 0.1)
     push_back (new LimitCall ("preprocessing", random.pick_int (0, 10)));
   if (random.generate_double () < 0.05)
@@ -1861,6 +1924,31 @@ void Trace::generate_constraint (Random &random, int minvars, int maxvars,
   push_back (new ConstrainCall (0));
 }
 
+// Occasionally imports a copy of one of the clauses added so far.
+
+void Trace::generate_import (Random &random) {
+  if (random.generate_double () < 0.9)
+    return;
+  vector<size_t> starts;
+  size_t start = 0;
+  for (size_t i = 0; i < size (); i++) {
+    Call *c = calls[i];
+    if (c->type != Call::ADD)
+      start = i + 1;
+    else if (!c->arg) {
+      if (start < i)
+        starts.push_back (start);
+      start = i + 1;
+    }
+  }
+  if (starts.empty ())
+    return;
+  size_t i = starts[random.pick_int (0, (int) starts.size () - 1)];
+  while (calls[i]->arg)
+    push_back (new ImportCall (calls[i++]->arg));
+  push_back (new ImportCall (0));
+}
+
 /*------------------------------------------------------------------------*/
 
 void Trace::generate_propagator (Random &random, int minvars, int maxvars) {
@@ -2212,7 +2300,8 @@ void Trace::generate (uint64_t i, uint64_t s) {
 
     for (int j = 0; j < clauses; j++)
       generate_queries (random), generate_reserve (random, maxvars),
-          generate_clause (random, minvars, maxvars, uniform);
+          generate_clause (random, minvars, maxvars, uniform),
+          generate_import (random);
 
     if (in_connection && random.generate_bool ()) {
       observed_vars.clear ();
@@ -2643,12 +2732,14 @@ bool Trace::shrink_clauses (int expected) {
   Segments segments;
   for (size_t r = size (), l; r > 1; r = l) {
     Call *c = calls[l = r - 1];
-    while (l > 0 && (c->type != Call::ADD || c->arg))
+    while (l > 0 &&
+           ((c->type != Call::ADD && c->type != Call::IMPORT) || c->arg))
       c = calls[--l];
     if (!l)
       break;
     r = l + 1;
-    while ((c = calls[--l])->type == Call::ADD && c->arg)
+    const uint64_t type = c->type; // Added or imported clause.
+    while ((c = calls[--l])->type == type && c->arg)
       ;
     segments.push_back (Segment (++l, r));
   }
@@ -2709,6 +2800,8 @@ bool Trace::shrink_literals (int expected) {
     Call *c = calls[l];
     if (c->type == Call::ADD && c->arg)
       segments.push_back (Segment (l, l + 1));
+    if (c->type == Call::IMPORT && c->arg)
+      segments.push_back (Segment (l, l + 1));
     if (c->type == Call::LEMMA && c->arg)
       segments.push_back (Segment (l, l + 1));
   }
@@ -2894,7 +2987,7 @@ bool Trace::reduce_values (int expected) {
         lo = o->lo, hi = o->hi;
       } else if (c->type == Call::LIMIT) {
         if (!strcmp (c->name, "conflicts") ||
-            !strcmp (c->name, "decisions"))
+            !strcmp (c->name, "decisions") || !strcmp (c->name, "ticks"))
           lo = -1, hi = INT_MAX;
         else if (!strcmp (c->name, "terminate") ||
                  !strcmp (c->name, "preprocessing"))
@@ -2973,6 +3066,7 @@ static bool has_lit_arg_type (Call *c) {
   switch (c->type) {
   case Call::ADD:
   case Call::CONSTRAIN:
+  case Call::IMPORT:
   case Call::ASSUME:
   case Call::FREEZE:
   case Call::MELT:
@@ -3174,7 +3268,7 @@ static bool is_valid_char (int ch) {
 
 void Reader::parse () {
   int ch, lit = 0, val = 0, adding = 0, constraining = 0, lemma_adding = 0,
-          solved = 0;
+          importing = 0, solved = 0;
   uint64_t state = 0;
   const bool enforce = !mobical.donot.enforce;
   Call *before_trigger = 0;
@@ -3330,6 +3424,17 @@ void Reader::parse () {
         error ("invalid literal '%d' as argument to 'constrain'", lit);
       constraining = lit;
       c = new ConstrainCall (lit);
+    } else if (!strcmp (keyword, "import")) {
+      if (!first)
+        error ("argument to 'import' missing");
+      if (!parse_int_str (first, lit))
+        error ("invalid argument '%s' to 'import'", first);
+      if (second)
+        error ("additional argument '%s' to 'import'", second);
+      if (enforce && lit == INT_MIN)
+        error ("invalid literal '%d' as argument to 'import'", lit);
+      importing = lit;
+      c = new ImportCall (lit);
     } else if (!strcmp (keyword, "connect")) {
       c = new ConnectCall ();
     } else if (!strcmp (keyword, "disconnect")) {
@@ -3551,6 +3656,10 @@ void Reader::parse () {
         error ("'%s' after 'lemma %d' without 'lemma 0'", c->keyword (),
                lemma_adding);
 
+      if (importing && c->type != Call::IMPORT && c->type != Call::RESET)
+        error ("'%s' after 'import %d' without 'import 0'", c->keyword (),
+               importing);
+
       if (constraining && c->type != Call::FIXED &&
           c->type != Call::CONSTRAIN && c->type != Call::RESET)
         error ("'%s' after 'constrain %d' without 'constrain 0'",
@@ -3587,6 +3696,14 @@ void Reader::parse () {
         new_state = Call::BEFORE;
         break;
 
+      case Call::IMPORT:
+        if (state == Call::SOLVE || state == Call::LEMMA)
+          break; // Traced during 'solve' (see 'TracingImporter').
+        if (state != Call::BEFORE)
+          before_trigger = c;
+        new_state = Call::BEFORE;
+        break;
+
       case Call::VAL:
       case Call::FLIP:
       case Call::FLIPPABLE:
@@ -3714,6 +3831,7 @@ Mobical::~Mobical () {
     munmap (shared, sizeof *shared);
   if (mock_pointer)
     delete mock_pointer;
+  delete_mock_importer ();
 }
 
 void Mobical::catch_signal (int) {
@@ -1,6 +1,7 @@
 #ifndef _occs_h_INCLUDED
 #define _occs_h_INCLUDED
 
+#include <cstdint>
 #include <vector>
 
 namespace CaDiCaL {
@@ -31,6 +32,10 @@ inline void remove_occs (Occs &os, Clause *c) {
 typedef Occs::iterator occs_iterator;
 typedef Occs::const_iterator const_occs_iterator;
 
+// Clause signatures kept parallel to occurrence lists in 'subsume'.
+
+typedef vector<uint64_t> Sigs;
+
 } // namespace CaDiCaL
 
 #endif
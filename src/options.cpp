@@ -172,6 +172,18 @@ void Options::set (Option *o, int new_val) {
   val = new_val;
   LOG ("set option 'set (\"%s\", %d)' from '%d'", o->name, new_val,
        old_val);
+
+  // Gauss-Jordan elimination does not work on the multitrail of 'reimply'
+  // (see 'gauss.cpp').  As 'reimply' is enabled by default, enabling one of
+  // them explicitly disables the other one.
+  //
+  if (new_val && &val == &gauss && reimply) {
+    LOG ("disabling 'reimply' since 'gauss' is enabled");
+    reimply = 0;
+  } else if (new_val && &val == &reimply && gauss) {
+    LOG ("disabling 'gauss' since 'reimply' is enabled");
+    gauss = 0;
+  }
 }
 
 // Explicit option value setting.
@@ -23,6 +23,7 @@
 \
 OPTION( arena,             1,  0,  1,0,0,1, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1,0,0,1, "keep clauses compact") \
+OPTION( arenanew,          1,  0,  1,0,0,1, "allocate new clauses in arena") \
 OPTION( arenasort,         1,  0,  1,0,0,1, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3,0,0,1, "1=clause, 2=var, 3=queue") \
 OPTION( binary,            1,  0,  1,0,0,1, "use binary proof format") \
@@ -33,6 +34,10 @@ OPTION( blockocclim,     1e2,  1,2e9,2,0,1, "occurrence limit") \
 OPTION( bump,              1,  0,  1,0,0,1, "bump variables") \
 OPTION( bumpreason,        1,  0,  1,0,0,1, "bump reason literals too") \
 OPTION( bumpreasondepth,   1,  1,  3,0,0,1, "bump reason depth") \
+OPTION( bva,               0,  0,  1,0,1,1, "bounded variable addition (DRAT proofs only)") \
+OPTION( bvamaxeff,       1e8,  0,2e9,1,0,1, "maximum efficiency") \
+OPTION( bvamineff,       1e6,  0,2e9,1,0,1, "minimum efficiency") \
+OPTION( bvareleff,        30,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( check,             0,  0,  1,0,0,0, "enable internal checking") \
 OPTION( checkassumptions,  1,  0,  1,0,0,0, "check assumptions satisfied") \
 OPTION( checkconstraint,   1,  0,  1,0,0,0, "check constraint satisfied") \
@@ -53,13 +58,13 @@ OPTION( conditionint,    1e4,  1,2e9,0,0,1, "initial conflict interval") \
 OPTION( conditionmaxeff, 1e7,  0,2e9,1,0,1, "maximum condition efficiency") \
 OPTION( conditionmaxrat, 100,  1,2e9,1,0,1, "maximum clause variable ratio") \
 OPTION( conditionmineff, 1e6,  0,2e9,1,0,1, "minimum condition efficiency") \
-OPTION( conditionreleff, 100,  1,1e5,0,0,1, "relative efficiency per mille") \
+OPTION( conditionreleff,  30,  1,1e5,0,0,1, "relative efficiency per mille") \
 OPTION( cover,             0,  0,  1,0,1,1, "covered clause elimination") \
 OPTION( covermaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( covermaxeff,     1e8,  0,2e9,1,0,1, "maximum cover efficiency") \
 OPTION( coverminclslim,    2,  2,2e9,0,0,1, "minimum clause size") \
 OPTION( covermineff,     1e6,  0,2e9,1,0,1, "minimum cover efficiency") \
-OPTION( coverreleff,       4,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( coverreleff,       1,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( decompose,         1,  0,  1,0,1,1, "decompose BIG in SCCs and ELS") \
 OPTION( decomposerounds,   2,  1, 16,1,0,1, "number of decompose rounds") \
 OPTION( deduplicate,       1,  0,  1,0,1,1, "remove duplicated binaries") \
@@ -73,16 +78,17 @@ OPTION( elimboundmax,     16, -1,2e6,1,0,1, "maximum elimination bound") \
 OPTION( elimboundmin,      0, -1,2e6,0,0,1, "minimum elimination bound") \
 OPTION( elimclslim,      1e2,  2,2e9,2,0,1, "resolvent size limit") \
 OPTION( elimequivs,        1,  0,  1,0,0,1, "find equivalence gates") \
-OPTION( elimineff,       1e7,  0,2e9,1,0,1, "minimum elimination efficiency") \
+OPTION( elimineff,       4e7,  0,2e9,1,0,1, "minimum elimination efficiency") \
 OPTION( elimint,         2e3,  1,2e9,0,0,1, "elimination interval") \
 OPTION( elimites,          1,  0,  1,0,0,1, "find if-then-else gates") \
-OPTION( elimlimited,       1,  0,  1,0,0,1, "limit resolutions") \
+OPTION( elimlimited,       1,  0,  1,0,0,1, "limit elimination ticks") \
 OPTION( elimocclim,      1e2,  0,2e9,2,0,1, "occurrence limit") \
 OPTION( elimprod,          1,  0,1e4,0,0,1, "elim score product weight") \
 OPTION( elimreleff,      1e3,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( elimrounds,        2,  1,512,1,0,1, "usual number of rounds") \
 OPTION( elimsubst,         1,  0,  1,0,0,1, "elimination by substitution") \
 OPTION( elimsum,           1,  0,1e4,0,0,1, "elimination score sum weight") \
+OPTION( elimthreads,       0,  0, 64,0,0,1, "parallel elimination threads") \
 OPTION( elimxorlim,        5,  2, 27,1,0,1, "maximum XOR size") \
 OPTION( elimxors,          1,  0,  1,0,0,1, "find XOR gates") \
 OPTION( emagluefast,      33,  1,2e9,0,0,1, "window fast glue") \
@@ -98,6 +104,10 @@ OPTION( flushfactor,       3,  1,1e3,0,0,1, "interval increase") \
 OPTION( flushint,        1e5,  1,2e9,0,0,1, "initial limit") \
 OPTION( forcephase,        0,  0,  1,0,0,1, "always use initial phase") \
 OPTION( frat,              0,  0,  2,0,0,1, "1=frat(lrat), 2=frat(drat)") \
+OPTION( gauss,             0,  0,  1,0,1,1, "Gauss-Jordan XOR reasoning") \
+OPTION( gausscollim,    1024,  2,1e5,1,0,1, "maximum matrix columns") \
+OPTION( gaussxorlim,       5,  3, 20,1,0,1, "maximum XOR size") \
+OPTION( heaparity,         4,  2, 16,0,0,1, "arity of scores heap") \
 OPTION( idrup,             0,  0,  1,0,0,1, "incremental proof format") \
 OPTION( ilb,               1,  0,  1,0,0,1, "ILB (incremental lazy backtrack)") \
 OPTION( ilbassumptions,    1,  0,  1,0,0,1, "trail reuse for assumptions (ILB-like)") \
@@ -110,16 +120,19 @@ LOGOPT( log,               0,  0,  1,0,0,0, "enable logging") \
 LOGOPT( logsort,           0,  0,  1,0,0,0, "sort logged clauses") \
 OPTION( lrat,              0,  0,  1,0,0,1, "use lrat proof format") \
 OPTION( lucky,             1,  0,  1,0,0,1, "search for lucky phases") \
+OPTION( luckythreads,      0,  0,  8,0,0,1, "lucky phases threads") \
 OPTION( minimize,          1,  0,  1,0,0,1, "minimize learned clauses") \
 OPTION( minimizedepth,   1e3,  0,1e3,0,0,1, "minimization depth") \
 OPTION( otfs,              1,  0,  1,0,0,1, "on-the-fly self subsumption") \
 OPTION( phase,             1,  0,  1,0,0,1, "initial phase") \
+OPTION( prefetch,          0,  0,1e3,0,0,1, "prefetch distance (0=disabled)") \
 OPTION( probe,             1,  0,  1,0,1,1, "failed literal probing" ) \
+OPTION( probebits,         1,  0,  1,0,0,1, "bit-parallel probing") \
 OPTION( probehbr,          1,  0,  1,0,0,1, "learn hyper binary clauses") \
 OPTION( probeint,        5e3,  1,2e9,0,0,1, "probing interval" ) \
-OPTION( probemaxeff,     1e8,  0,2e9,1,0,1, "maximum probing efficiency") \
-OPTION( probemineff,     1e6,  0,2e9,1,0,1, "minimum probing efficiency") \
-OPTION( probereleff,      20,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( probemaxeff,     5e8,  0,2e9,1,0,1, "maximum probing efficiency") \
+OPTION( probemineff,     5e6,  0,2e9,1,0,1, "minimum probing efficiency") \
+OPTION( probereleff,      40,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( proberounds,       1,  1, 16,1,0,1, "probing rounds" ) \
 OPTION( profile,           2,  0,  4,0,0,0, "profiling level") \
 QUTOPT( quiet,             0,  0,  1,0,0,0, "disable all messages") \
@@ -148,12 +161,16 @@ OPTION( reverse,           0,  0,  1,0,0,1, "reverse variable ordering") \
 OPTION( score,             1,  0,  1,0,0,1, "use EVSIDS scores") \
 OPTION( scorefactor,     950,500,1e3,0,0,1, "score factor per mille") \
 OPTION( seed,              0,  0,2e9,0,0,1, "random seed") \
+OPTION( selective,         0,  0,  1,0,0,1, "non-moving selective collection") \
+OPTION( selectiveint,      4,  1,1e3,0,0,1, "full collection interval") \
 OPTION( shrink,            3,  0,  3,0,0,1, "shrink conflict clause") \
 OPTION( shrinkreap,        1,  0,  1,0,0,1, "use a reap for shrinking") \
 OPTION( shuffle,           0,  0,  1,0,0,1, "shuffle variables") \
 OPTION( shufflequeue,      1,  0,  1,0,0,1, "shuffle variable queue") \
 OPTION( shufflerandom,     0,  0,  1,0,0,1, "not reverse but random") \
 OPTION( shufflescores,     1,  0,  1,0,0,1, "shuffle variable scores") \
+OPTION( simd,              1,  0,  1,0,0,1, "vectorized replacement search") \
+OPTION( specialize,        1,  0,  1,0,0,1, "specialized propagation kernels") \
 OPTION( stabilize,         1,  0,  1,0,0,1, "enable stabilizing phases") \
 OPTION( stabilizefactor, 200,101,2e9,0,0,1, "phase increase in percent") \
 OPTION( stabilizeint,    1e3,  1,2e9,0,0,1, "stabilizing interval") \
@@ -168,8 +185,9 @@ OPTION( subsumelimited,    1,  0,  1,0,0,1, "limit subsumption checks") \
 OPTION( subsumemaxeff,   1e8,  0,2e9,1,0,1, "maximum subsuming efficiency") \
 OPTION( subsumemineff,   1e6,  0,2e9,1,0,1, "minimum subsuming efficiency") \
 OPTION( subsumeocclim,   1e2,  0,2e9,1,0,1, "watch list length limit") \
-OPTION( subsumereleff,   1e3,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( subsumereleff,   300,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( subsumestr,        1,  0,  1,0,0,1, "strengthen during subsume") \
+OPTION( subsumethreads,    0,  0, 64,0,0,1, "parallel subsumption threads") \
 OPTION( target,            1,  0,  2,0,0,1, "target phases (1=stable only)") \
 OPTION( terminateint,     10,  0,1e4,0,0,1, "termination check interval") \
 OPTION( ternary,           1,  0,  1,0,1,1, "hyper ternary resolution") \
@@ -177,27 +195,30 @@ OPTION( ternarymaxadd,   1e3,  0,1e4,1,0,1, "max clauses added in percent") \
 OPTION( ternarymaxeff,   1e8,  0,2e9,1,0,1, "ternary maximum efficiency") \
 OPTION( ternarymineff,   1e6,  1,2e9,1,0,1, "minimum ternary efficiency") \
 OPTION( ternaryocclim,   1e2,  1,2e9,2,0,1, "ternary occurrence limit") \
-OPTION( ternaryreleff,    10,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( ternaryreleff,     3,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( ternaryrounds,     2,  1, 16,1,0,1, "maximum ternary rounds") \
+OPTION( trailsave,         1,  0,  1,0,0,1, "save trail at back-jumps") \
 OPTION( transred,          1,  0,  1,0,1,1, "transitive reduction of BIG") \
 OPTION( transredmaxeff,  1e8,  0,2e9,1,0,1, "maximum efficiency") \
 OPTION( transredmineff,  1e6,  0,2e9,1,0,1, "minimum efficiency") \
-OPTION( transredreleff,  1e2,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( transredreleff,   30,  1,1e5,1,0,1, "relative efficiency per mille") \
 QUTOPT( verbose,           0,  0,  3,0,0,0, "more verbose messages") \
 OPTION( veripb,            0,  0,  4,0,0,1, "odd=checkdeletions, > 2=drat") \
 OPTION( vivify,            1,  0,  1,0,1,1, "vivification") \
 OPTION( vivifyinst,        1,  0,  1,0,0,1, "instantiate last literal when vivify") \
-OPTION( vivifymaxeff,    2e7,  0,2e9,1,0,1, "maximum efficiency") \
-OPTION( vivifymineff,    2e4,  0,2e9,1,0,1, "minimum efficiency") \
+OPTION( vivifymaxeff,    1e8,  0,2e9,1,0,1, "maximum efficiency") \
+OPTION( vivifymineff,    1e5,  0,2e9,1,0,1, "minimum efficiency") \
 OPTION( vivifyonce,        0,  0,  2,0,0,1, "vivify once: 1=red, 2=red+irr") \
 OPTION( vivifyredeff,     75,  0,1e3,1,0,1, "redundant efficiency per mille") \
-OPTION( vivifyreleff,     20,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( vivifyreleff,     40,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( walk,              1,  0,  1,0,0,1, "enable random walks") \
+OPTION( walkcache,         0,  0,  1,0,0,1, "cache break counts in walk") \
 OPTION( walkmaxeff,      1e7,  0,2e9,1,0,1, "maximum efficiency") \
 OPTION( walkmineff,      1e5,  0,1e7,1,0,1, "minimum efficiency") \
 OPTION( walknonstable,     1,  0,  1,0,0,1, "walk in non-stabilizing phase") \
 OPTION( walkredundant,     0,  0,  1,0,0,1, "walk redundant clauses too") \
-OPTION( walkreleff,       20,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( walkreleff,        7,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( walkthreads,       0,  0, 64,0,0,1, "background local search threads") \
 
 // Note, keep an empty line right before this line because of the last '\'!
 // Also keep those single spaces after 'OPTION(' for proper sorting.
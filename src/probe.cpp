@@ -388,19 +388,18 @@ inline void Internal::probe_propagate2 () {
   while (propagated2 != trail.size ()) {
     const int lit = -trail[propagated2++];
     LOG ("probe propagating %d over binary clauses", -lit);
-    Watches &ws = watches (lit);
+    Watches &ws = bwatches (lit);
+    stats.ticks.probe += 1 + cache_lines (ws);
     for (const auto &w : ws) {
-      if (!w.binary ())
-        continue;
       const signed char b = val (w.blit);
       if (b > 0)
         continue;
       if (b < 0)
-        conflict = w.clause; // but continue
+        conflict = watched (w); // but continue
       else {
         assert (lrat_chain.empty ());
         assert (!probe_reason);
-        probe_reason = w.clause;
+        probe_reason = watched (w);
         probe_lrat_for_units (w.blit);
         probe_assign (w.blit, -lit);
         lrat_chain.clear ();
@@ -414,6 +413,7 @@ bool Internal::probe_propagate () {
   assert (!unsat);
   START (propagate);
   int64_t before = propagated2 = propagated;
+  int64_t ticks = 0;
   while (!conflict) {
     if (propagated2 != trail.size ())
       probe_propagate2 ();
@@ -421,26 +421,26 @@ bool Internal::probe_propagate () {
       const int lit = -trail[propagated++];
       LOG ("probe propagating %d over large clauses", -lit);
       Watches &ws = watches (lit);
+      ticks += 1 + cache_lines (ws);
       size_t i = 0, j = 0;
       while (i != ws.size ()) {
         const Watch w = ws[j++] = ws[i++];
-        if (w.binary ())
-          continue;
         const signed char b = val (w.blit);
         if (b > 0)
           continue;
-        if (w.clause->garbage)
+        ticks++;
+        if (watched (w)->garbage)
           continue;
-        const literal_iterator lits = w.clause->begin ();
+        const literal_iterator lits = watched (w)->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         // lits[0] = other, lits[1] = lit;
         const signed char u = val (other);
         if (u > 0)
           ws[j - 1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = watched (w)->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + watched (w)->pos;
           literal_iterator k = middle;
           int r = 0;
           signed char v = -1;
@@ -448,39 +448,39 @@ bool Internal::probe_propagate () {
             k++;
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (watched (w)->pos <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          watched (w)->pos = k - lits;
+          assert (lits + 2 <= k), assert (k <= watched (w)->end ());
           if (v > 0)
             ws[j - 1].blit = r;
           else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (watched (w), "unwatch %d in", r);
             *k = lit;
             lits[0] = other;
             lits[1] = r;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, watched (w));
             j--;
           } else if (!u) {
             if (level == 1) {
               lits[0] = other, lits[1] = lit;
               assert (lrat_chain.empty ());
               assert (!probe_reason);
-              int dom = hyper_binary_resolve (w.clause);
+              int dom = hyper_binary_resolve (watched (w));
               probe_assign (other, dom);
             } else {
               assert (lrat_chain.empty ());
               assert (!probe_reason);
-              probe_reason = w.clause;
+              probe_reason = watched (w);
               probe_lrat_for_units (other);
               probe_assign_unit (other);
               lrat_chain.clear ();
             }
             probe_propagate2 ();
           } else
-            conflict = w.clause;
+            conflict = watched (w);
         }
       }
       if (j != i) {
@@ -493,6 +493,7 @@ bool Internal::probe_propagate () {
   }
   int64_t delta = propagated2 - before;
   stats.propagations.probe += delta;
+  stats.ticks.probe += ticks;
   if (conflict)
     LOG (conflict, "conflict");
   STOP (propagate);
@@ -586,6 +587,181 @@ void Internal::failed_literal (int failed) {
 
 /*------------------------------------------------------------------------*/
 
+// Bit-parallel probing ('opts.probebits') propagates 64 probes at once
+// over binary and ternary clauses before the actual probing round.  The
+// active variables with binary or ternary occurrences are taken 32 at a
+// time and both phases of each variable get one bit (lane) in a 64-bit
+// word.  For every literal we compute the set of lanes in which it is
+// implied.  Since propagation is restricted to binary and ternary clauses
+// this is only an approximation of 'probe_propagate' and thus we only use
+// it to find candidates, which are then probed first by the exact probing
+// below.  This keeps proofs and LRAT chains as they are.  Candidates are
+//
+//   - failed literals (lanes with both phases of a variable implied),
+//   - the negation of literals implied by both phases of a variable (they
+//     are units, which are found as failed literals during probing), and
+//   - both phases of a variable equivalent to another literal, for which
+//     probing then adds the hyper binary resolvents needed by 'decompose'.
+
+void Internal::probe_bits (int64_t limit) {
+
+  // Occurrences of literals in ternary clauses without assigned literals.
+  //
+  vector<int> ternary;
+  for (const auto &c : clauses) {
+    if (c->garbage || c->size != 3)
+      continue;
+    const int *lits = c->literals;
+    if (val (lits[0]) || val (lits[1]) || val (lits[2]))
+      continue;
+    for (int i = 0; i < 3; i++)
+      ternary.push_back (lits[i]);
+  }
+  const size_t size = 2 * (max_var + 1) + 1;
+  vector<unsigned> offsets (size);
+  for (const auto lit : ternary)
+    offsets[vlit (lit) + 1]++;
+  for (size_t i = 1; i < size; i++)
+    offsets[i] += offsets[i - 1];
+  vector<unsigned> occurrences (ternary.size ());
+  {
+    vector<unsigned> next (offsets.begin (), offsets.end () - 1);
+    for (size_t i = 0; i < ternary.size (); i++)
+      occurrences[next[vlit (ternary[i])]++] = i - i % 3;
+  }
+
+  vector<uint64_t> mask (size), pending (size);
+  vector<int> lanes, touched, queue, candidates;
+  int64_t ticks = 0;
+  uint64_t failed = 0;
+
+  const auto imply = [&] (int lit, uint64_t bits) {
+    const signed char tmp = val (lit);
+    if (tmp > 0)
+      return;
+    if (tmp < 0) {
+      failed |= bits;
+      return;
+    }
+    uint64_t &m = mask[vlit (lit)];
+    bits &= ~m;
+    if (!bits)
+      return;
+    if (!m)
+      touched.push_back (lit);
+    m |= bits;
+    failed |= bits & mask[vlit (-lit)];
+    uint64_t &p = pending[vlit (lit)];
+    if (!p)
+      queue.push_back (lit);
+    p |= bits;
+  };
+
+  const auto occurs = [&] (int lit) {
+    const unsigned o = vlit (lit);
+    return !bwatches (lit).empty () || offsets[o] != offsets[o + 1];
+  };
+
+  int idx = 1;
+  while (ticks < limit && idx <= max_var) {
+
+    while (lanes.size () < 64 && idx <= max_var) {
+      const int v = idx++;
+      if (!active (v) || (!occurs (v) && !occurs (-v)))
+        continue;
+      lanes.push_back (v);
+      lanes.push_back (-v);
+    }
+    if (lanes.empty ())
+      break;
+    stats.bitprobed += lanes.size ();
+
+    for (size_t l = 0; l < lanes.size (); l++)
+      imply (lanes[l], (uint64_t) 1 << l);
+
+    for (size_t i = 0; i < queue.size () && ticks < limit; i++) {
+      const int lit = queue[i];
+      uint64_t &p = pending[vlit (lit)];
+      const uint64_t bits = p & ~failed;
+      p = 0;
+      if (!bits)
+        continue;
+      const Watches &ws = bwatches (-lit);
+      ticks += 1 + cache_lines (ws);
+      for (const auto &w : ws)
+        imply (w.blit, bits);
+      const unsigned o = vlit (-lit);
+      for (unsigned k = offsets[o]; k != offsets[o + 1]; k++) {
+        ticks++;
+        const int *t = &ternary[occurrences[k]];
+        const int a = t[0] == -lit ? t[1] : t[0];
+        const int b = t[2] == -lit ? t[1] : t[2];
+        const uint64_t fa = mask[vlit (-a)], fb = mask[vlit (-b)];
+        failed |= bits & fa & fb;
+        imply (a, bits & fb);
+        imply (b, bits & fa);
+      }
+    }
+
+    // Both lanes of a variable are still consistent.
+    //
+    const uint64_t even = 0x5555555555555555ull;
+    const uint64_t consistent = ~failed & (~failed >> 1) & even;
+
+    for (size_t l = 0; l < lanes.size (); l++)
+      if (failed & ((uint64_t) 1 << l)) {
+        LOG ("bit-parallel failed literal candidate %d", lanes[l]);
+        stats.bitfailed++;
+        candidates.push_back (lanes[l]);
+      }
+
+    for (const auto lit : touched) {
+      const uint64_t m = mask[vlit (lit)];
+      uint64_t lifted = m & (m >> 1) & consistent;
+      uint64_t equivalent = m & (mask[vlit (-lit)] >> 1) & consistent;
+      for (size_t l = 0; lifted | equivalent; l += 2, lifted >>= 2,
+                  equivalent >>= 2) {
+        if (abs (lanes[l]) == abs (lit))
+          continue;
+        if (lifted & 1) {
+          LOG ("bit-parallel lifted unit candidate %d", lit);
+          stats.bitlifted++;
+          candidates.push_back (-lit);
+        }
+        if (equivalent & 1) {
+          LOG ("bit-parallel equivalent candidate %d = %d", lanes[l], lit);
+          stats.bitequivalent++;
+          candidates.push_back (lanes[l]);
+          candidates.push_back (lanes[l + 1]);
+        }
+      }
+    }
+
+    for (const auto lit : touched)
+      mask[vlit (lit)] = 0;
+    for (const auto lit : queue)
+      pending[vlit (lit)] = 0;
+    touched.clear ();
+    queue.clear ();
+    lanes.clear ();
+    failed = 0;
+  }
+  stats.ticks.probe += ticks;
+
+  // Probe candidates first (probes are taken from the back).
+  //
+  sort (candidates.begin (), candidates.end ());
+  const auto last = unique (candidates.begin (), candidates.end ());
+  for (auto i = candidates.begin (); i != last; i++)
+    probes.push_back (*i);
+
+  PHASE ("probe-round", stats.probingrounds,
+         "bit-parallel probing found %zd candidates in %" PRId64 " ticks",
+         (size_t) (last - candidates.begin ()), ticks);
+}
+
+/*------------------------------------------------------------------------*/
+
 bool Internal::is_binary_clause (Clause *c, int &a, int &b) {
   assert (!level);
   if (c->garbage)
@@ -777,13 +953,13 @@ bool Internal::probe_round () {
   START_SIMPLIFIER (probe, PROBE);
   stats.probingrounds++;
 
-  // Probing is limited in terms of non-probing propagations
-  // 'stats.propagations'. We allow a certain percentage 'opts.probereleff'
-  // (say %5) of probing propagations in each probing with a lower bound of
-  // 'opts.probmineff'.
+  // Probing is limited in terms of search ticks 'stats.ticks.search' (see
+  // 'cache_lines' in 'util.hpp'). We allow a certain percentage
+  // 'opts.probereleff' (say %5) of probing ticks in each probing with a
+  // lower bound of 'opts.probmineff'.
   //
-  int64_t delta = stats.propagations.search;
-  delta -= last.probe.propagations;
+  int64_t delta = stats.ticks.search;
+  delta -= last.probe.ticks;
   delta *= 1e-3 * opts.probereleff;
   if (delta < opts.probemineff)
     delta = opts.probemineff;
@@ -792,9 +968,9 @@ bool Internal::probe_round () {
   delta += 2l * active ();
 
   PHASE ("probe-round", stats.probingrounds,
-         "probing limit of %" PRId64 " propagations ", delta);
+         "probing limit of %" PRId64 " ticks", delta);
 
-  int64_t limit = stats.propagations.probe + delta;
+  int64_t limit = stats.ticks.probe + delta;
 
   int old_failed = stats.failed;
 #ifndef QUIET
@@ -815,10 +991,16 @@ bool Internal::probe_round () {
   assert (unsat || propagated == trail.size ());
   propagated = propagated2 = trail.size ();
 
+  // Bit-parallel probing uses the same ticks budget but at most half of it
+  // since its candidates still have to be probed below.
+  //
+  if (opts.probebits)
+    probe_bits (delta / 2);
+
   int probe;
   init_probehbr_lrat ();
   while (!unsat && !terminated_asynchronously () &&
-         stats.propagations.probe < limit && (probe = next_probe ())) {
+         stats.ticks.probe < limit && (probe = next_probe ())) {
     stats.probed++;
     LOG ("probing %d", probe);
     probe_assign_decision (probe);
@@ -837,8 +1019,7 @@ bool Internal::probe_round () {
     if (!propagate ()) {
       LOG ("propagating units after probing results in empty clause");
       learn_empty_clause ();
-    } else
-      sort_watches ();
+    }
   }
 
   int failed = stats.failed - old_failed;
@@ -896,7 +1077,7 @@ void CaDiCaL::Internal::probe (bool update_limits) {
 
   decompose (); // ... and (ELS) afterwards.
 
-  last.probe.propagations = stats.propagations.search;
+  last.probe.ticks = stats.ticks.search;
 
   if (!update_limits)
     return;
@@ -42,6 +42,7 @@ struct Internal;
   PROFILE (backward, 3) \
   PROFILE (block, 2) \
   PROFILE (bump, 4) \
+  PROFILE (bva, 2) \
   PROFILE (checking, 2) \
   PROFILE (cdcl, 1) \
   PROFILE (collect, 3) \
@@ -54,6 +55,7 @@ struct Internal;
   PROFILE (decompose, 3) \
   PROFILE (elim, 2) \
   PROFILE (extend, 3) \
+  PROFILE (gauss, 2) \
   PROFILE (instantiate, 2) \
   PROFILE (lucky, 2) \
   PROFILE (lookahead, 2) \
@@ -68,6 +70,7 @@ struct Internal;
   PROFILE (restart, 3) \
   PROFILE (restore, 2) \
   PROFILE (search, 1) \
+  PROFILE (selective, 3) \
   PROFILE (solve, 0) \
   PROFILE (stable, 2) \
   PROFILE (preprocess, 2) \
@@ -229,6 +229,32 @@ void Proof::delete_external_original_clause (uint64_t id, bool r,
   delete_clause ();
 }
 
+void Proof::add_external_derived_clause (uint64_t id, bool r,
+                                         const vector<int> &c,
+                                         const vector<uint64_t> &chain) {
+  // literals of c are already external
+  assert (clause.empty ());
+  assert (proof_chain.empty ());
+  for (auto const &lit : c)
+    clause.push_back (lit);
+  for (const auto &cid : chain)
+    proof_chain.push_back (cid);
+  clause_id = id;
+  redundant = r;
+  add_derived_clause ();
+}
+
+void Proof::delete_external_clause (uint64_t id, bool r,
+                                    const vector<int> &c) {
+  // literals of c are already external
+  assert (clause.empty ());
+  for (auto const &lit : c)
+    clause.push_back (lit);
+  clause_id = id;
+  redundant = r;
+  delete_clause ();
+}
+
 void Proof::add_derived_empty_clause (uint64_t id,
                                       const vector<uint64_t> &chain) {
   LOG ("PROOF adding empty clause");
@@ -72,6 +72,14 @@ public:
   void delete_external_original_clause (uint64_t, bool,
                                         const vector<int> &);
 
+  // Renaming variables introduced by bounded variable addition (see
+  // 'External::rename_introduced') derives and deletes clauses given in
+  // external literals too.
+  //
+  void add_external_derived_clause (uint64_t, bool, const vector<int> &,
+                                    const vector<uint64_t> &);
+  void delete_external_clause (uint64_t, bool, const vector<int> &);
+
   // Add derived (such as learned) clauses to the proof.
   //
   void add_derived_empty_clause (uint64_t, const vector<uint64_t> &);
@@ -1,5 +1,10 @@
 #include "internal.hpp"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define AVX2_REPLACEMENT_SEARCH
+#include <immintrin.h>
+#endif
+
 namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
@@ -129,21 +134,36 @@ inline void Internal::elevate_lit (int lit, Clause *reason) {
     reason = 0;
     lrat_chain.clear ();
   }
+  const int old_level = v.level;
   v.level = lit_level;
   v.reason = reason;
   v.trail = trail_size (lit_level);
   trail_push (lit, lit_level);
+  update_conflict_levels (old_level);
 }
 
 /*------------------------------------------------------------------------*/
 
+// The propagation kernels and 'search_assign' below are templates with two
+// flags 'with_lrat' and 'with_external'.  If such a flag is false the
+// kernel assumes that LRAT chains are not built ('lrat' is false) or that
+// no external propagator is connected ('external_prop' is false) and the
+// corresponding checks and code are compiled out.  The kernel is selected
+// at the start of 'propagate' (see 'Internal::propagate' below).  If both
+// flags are true we get the generic version with all run-time checks.
+
+template <bool with_lrat, bool with_external>
 inline void Internal::search_assign (int lit, Clause *reason) {
 
   if (level)
     require_mode (SEARCH);
 
+  assert (with_lrat || !lrat);
+  assert (with_external || !external_prop);
+  assert (with_external || reason != external_reason);
+
   const int idx = vidx (lit);
-  const bool from_external = reason == external_reason;
+  const bool from_external = with_external && reason == external_reason;
   assert (!val (idx));
   assert (!flags (idx).eliminated () || reason == decision_reason ||
           reason == external_reason);
@@ -151,7 +171,7 @@ inline void Internal::search_assign (int lit, Clause *reason) {
   int lit_level;
   assert (!lrat || level || reason == external_reason ||
           reason == decision_reason || !lrat_chain.empty ());
-  if (reason == external_reason &&
+  if (from_external &&
       ((size_t) level <= assumptions.size () + (!!constraint.size ()))) {
     // On the pseudo-decision levels every external propagation must be
     // explained eagerly, in order to avoid complications during conflict
@@ -196,7 +216,8 @@ inline void Internal::search_assign (int lit, Clause *reason) {
   if (!searching_lucky_phases)
     phases.saved[idx] = tmp; // phase saving during search
   trail_push (lit, lit_level);
-  if (external_prop && !external_prop_is_lazy && opts.reimply) {
+  if (with_external && external_prop && !external_prop_is_lazy &&
+      opts.reimply) {
     notify_trail.push_back (lit);
   }
 #ifdef LOGGING
@@ -207,13 +228,23 @@ inline void Internal::search_assign (int lit, Clause *reason) {
 #endif
 
   if (watching ()) {
+    const Watches &bws = bwatches (-lit);
+    if (!bws.empty ())
+      __builtin_prefetch (&bws[0], 0, 1);
     const Watches &ws = watches (-lit);
     if (!ws.empty ()) {
       const Watch &w = ws[0];
       __builtin_prefetch (&w, 0, 1);
     }
   }
-  lrat_chain.clear ();
+  if (with_lrat)
+    lrat_chain.clear ();
+  else
+    assert (lrat_chain.empty ());
+}
+
+inline void Internal::search_assign (int lit, Clause *reason) {
+  search_assign<true, true> (lit, reason);
 }
 
 // pushes lit on trail for level l
@@ -223,8 +254,7 @@ inline void Internal::trail_push (int lit, int l) {
     trail.push_back (lit);
     return;
   }
-  assert (l > 0 && trails.size () >= (size_t) l);
-  trails[l - 1].push_back (lit);
+  trails.push (l, lit);
 }
 
 /*------------------------------------------------------------------------*/
@@ -272,6 +302,133 @@ void Internal::elevate_lit_external (int lit, Clause *reason) {
 
 /*------------------------------------------------------------------------*/
 
+// Vectorized version of the replacement search in 'find_replacement' using
+// AVX2 gather instructions, which fetch the values of eight literals at
+// once.  Since there is no byte gather, we gather four bytes starting at
+// each 'vals[lit]' (which is why 'vals' has three bytes of padding) and
+// only use the sign bit of the least significant byte.  The remaining
+// literals (less than eight) are checked with the scalar loop.  SSE4 has
+// no gather instructions and would not be faster than the scalar loop.
+// On other architectures 'simd_supported' is false and this function is
+// never called.
+
+#ifdef AVX2_REPLACEMENT_SEARCH
+
+bool Internal::simd_supported () {
+  return __builtin_cpu_supports ("avx2");
+}
+
+__attribute__ ((target ("avx2"))) literal_iterator
+Internal::find_replacement_simd (literal_iterator k,
+                                 const_literal_iterator end) {
+  const int *base = (const int *) vals;
+  while (end - k >= 8) {
+    const __m256i lits = _mm256_loadu_si256 ((const __m256i *) k);
+    const __m256i gathered = _mm256_i32gather_epi32 (base, lits, 1);
+    const __m256i shifted = _mm256_slli_epi32 (gathered, 24);
+    const unsigned mask =
+        (unsigned) _mm256_movemask_ps (_mm256_castsi256_ps (shifted));
+    if (mask != 0xff) // not all eight literals false
+      return k + __builtin_ctz (~mask);
+    k += 8;
+  }
+  while (k != end && val (*k) < 0)
+    k++;
+  return k;
+}
+
+#else
+
+bool Internal::simd_supported () { return false; }
+
+literal_iterator
+Internal::find_replacement_simd (literal_iterator k,
+                                 const_literal_iterator end) {
+  while (k != end && val (*k) < 0)
+    k++;
+  return k;
+}
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
+// Replay the saved trail (see 'saved.hpp') after its head was assigned.
+// Implied literals are assigned with their saved reason before the watches
+// of the propagated literal are visited, which usually finds the conflict
+// of the saved trail again much earlier.  Every reason is checked to
+// still contain the implied literal, with all other literals falsified and
+// at least one of them on the propagated level 'replay_level', which keeps
+// the watch invariants.  If such a check fails the rest of the saved trail
+// is dropped.  Replayed literals are still propagated through their watch
+// lists afterwards.  With 'opts.reimply' lower levels are propagated in
+// 'propagate_multitrail', where conflicts have to be registered with their
+// conflict level.  There we simply drop the saved trail at a conflict and
+// leave it to the watches to find it.
+
+template <bool with_lrat, bool with_external>
+void Internal::replay_saved_trail (int replay_level) {
+  assert (!saved_trail.empty ());
+  assert (val (saved_trail.head ()) > 0);
+  assert (!conflict);
+  const auto &entries = saved_trail.entries;
+  size_t next = saved_trail.next + 1;
+  while (next != entries.size ()) {
+    const int lit = entries[next].lit;
+    const signed char tmp = val (lit);
+    if (tmp > 0) {
+      next++;
+      continue;
+    }
+    Clause *reason = entries[next].reason;
+    if (!reason)
+      break; // Saved decision not assigned (yet).
+    if (reason->garbage) {
+      saved_trail.clear ();
+      return;
+    }
+    int reason_level = 0;
+    bool found = false;
+    for (const auto other : *reason) {
+      if (other == lit) {
+        found = true;
+        continue;
+      }
+      if (val (other) >= 0) {
+        reason_level = -1;
+        break;
+      }
+      const int other_level = var (other).level;
+      if (other_level > reason_level)
+        reason_level = other_level;
+    }
+    if (!found || reason_level != replay_level) {
+      LOG (reason, "saved trail invalid at %d with reason", lit);
+      saved_trail.clear ();
+      return;
+    }
+    next++;
+    if (tmp < 0) {
+      if (replay_level < level) {
+        LOG (reason, "saved trail conflict below current level");
+        saved_trail.clear ();
+        return;
+      }
+      LOG (reason, "saved trail conflict");
+      stats.trailsave.conflicts++;
+      conflict = reason;
+      break;
+    }
+    stats.trailsave.reused++;
+    if (with_lrat)
+      build_chain_for_units (lit, reason, 0);
+    search_assign<with_lrat, with_external> (lit, reason);
+  }
+  saved_trail.next = next;
+}
+
+/*------------------------------------------------------------------------*/
+
 // The 'propagate' function is usually the hot-spot of a CDCL SAT solver.
 // The 'trail' stack saves assigned variables and is used here as BFS queue
 // for checking clauses with the negation of assigned variables for being in
@@ -280,18 +437,19 @@ void Internal::elevate_lit_external (int lit, Clause *reason) {
 // This version of 'propagate' uses lazy watches and keeps two watched
 // literals at the beginning of the clause.  We also use 'blocking literals'
 // to reduce the number of times clauses have to be visited (2008 JSAT paper
-// by Chu, Harwood and Stuckey).  The watches know if a watched clause is
-// binary, in which case it never has to be visited.  If a binary clause is
-// falsified we continue propagating.
+// by Chu, Harwood and Stuckey).  Binary clauses are watched in separate
+// watch lists 'bwatches', which are traversed before the watches of large
+// clauses, and binary clauses never have to be visited.  If a binary
+// clause is falsified we continue propagating binary clauses but skip the
+// large ones.
 
 // Finally, for long clauses we save the position of the last watch
 // replacement in 'pos', which in turn reduces certain quadratic accumulated
 // propagation costs (2013 JAIR article by Ian Gent) at the expense of four
 // more bytes for each clause.
 
-bool Internal::propagate () {
-  if (opts.reimply)
-    return propagate_clean ();
+template <bool with_lrat, bool with_external>
+bool Internal::propagate_kernel () {
 
   if (level)
     require_mode (SEARCH);
@@ -303,12 +461,77 @@ bool Internal::propagate () {
   // delay until propagation ran to completion.
   //
   int64_t before = propagated;
+  int64_t ticks = 0;
+
+  // Number of watches to look ahead for prefetching clauses.
+  //
+  const ptrdiff_t distance = opts.prefetch;
 
   while (!conflict && propagated != trail.size ()) {
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
+
+    if (!saved_trail.empty ()) {
+      const signed char tmp = val (saved_trail.head ());
+      if (tmp > 0)
+        replay_saved_trail<with_lrat, with_external> (level);
+      else if (tmp < 0)
+        saved_trail.clear (); // Saved trail diverged.
+      if (conflict)
+        break;
+    }
+
+    ticks += 1 + cache_lines (bwatches (lit));
+
+    for (const auto &w : bwatches (lit)) {
+
+      const signed char b = val (w.blit);
+
+      if (b > 0)
+        continue; // other literal satisfied
+
+      // In principle we can ignore garbage binary clauses too, but that
+      // would require to dereference the clause pointer all the time with
+      //
+      // if (watched (w)->garbage) { j--; continue; } // (*)
+      //
+      // This is too costly.  It is however necessary to produce correct
+      // proof traces if binary clauses are traced to be deleted ('d ...'
+      // line) immediately as soon they are marked as garbage.  Actually
+      // finding instances where this happens is pretty difficult (six
+      // parallel fuzzing jobs in parallel took an hour), but it does
+      // occur.  Our strategy to avoid generating incorrect proofs now is
+      // to delay tracing the deletion of binary clauses marked as garbage
+      // until they are really deleted from memory.  For large clauses
+      // this is not necessary since we have to access the clause anyhow.
+      //
+      // Thanks go to Mathias Fleury, who wanted me to explain why the
+      // line '(*)' above was in the code. Removing it actually really
+      // improved running times and thus I tried to find concrete
+      // instances where this happens (which I found), and then
+      // implemented the described fix.
+
+      // Binary clauses are watched in separate watch lists and
+      // propagated first, since they do not require to access the clause
+      // at all (only during conflict analysis, and there also only to
+      // simplify the code).
+
+      if (b < 0)
+        conflict = watched (w); // but continue ...
+      else {
+        if (with_lrat)
+          build_chain_for_units (w.blit, watched (w), 0);
+        search_assign<with_lrat, with_external> (w.blit, watched (w));
+        // lrat_chain.clear (); done in search_assign
+      }
+    }
+
+    if (conflict)
+      break; // Stop if there was a binary conflict already.
+
     Watches &ws = watches (lit);
+    ticks += cache_lines (ws);
 
     const const_watch_iterator eow = ws.end ();
     watch_iterator j = ws.begin ();
@@ -317,191 +540,167 @@ bool Internal::propagate () {
     while (i != eow) {
 
       const Watch w = *j++ = *i++;
+
+      // Prefetch the clause of the watch 'distance' positions ahead in
+      // order to overlap its cache miss with the work on the current
+      // watches, unless its blocking literal is already satisfied.
+      //
+      if (distance && distance <= eow - i) {
+        const Watch &ahead = i[distance - 1];
+        if (val (ahead.blit) <= 0)
+          __builtin_prefetch (watched (ahead), 1, 1);
+      }
+
       const signed char b = val (w.blit);
 
       if (b > 0)
         continue; // blocking literal satisfied
 
-      if (w.binary ()) {
-
-        // In principle we can ignore garbage binary clauses too, but that
-        // would require to dereference the clause pointer all the time with
-        //
-        // if (w.clause->garbage) { j--; continue; } // (*)
-        //
-        // This is too costly.  It is however necessary to produce correct
-        // proof traces if binary clauses are traced to be deleted ('d ...'
-        // line) immediately as soon they are marked as garbage.  Actually
-        // finding instances where this happens is pretty difficult (six
-        // parallel fuzzing jobs in parallel took an hour), but it does
-        // occur.  Our strategy to avoid generating incorrect proofs now is
-        // to delay tracing the deletion of binary clauses marked as garbage
-        // until they are really deleted from memory.  For large clauses
-        // this is not necessary since we have to access the clause anyhow.
-        //
-        // Thanks go to Mathias Fleury, who wanted me to explain why the
-        // line '(*)' above was in the code. Removing it actually really
-        // improved running times and thus I tried to find concrete
-        // instances where this happens (which I found), and then
-        // implemented the described fix.
-
-        // Binary clauses are treated separately since they do not require
-        // to access the clause at all (only during conflict analysis, and
-        // there also only to simplify the code).
-
-        if (b < 0)
-          conflict = w.clause; // but continue ...
-        else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          search_assign (w.blit, w.clause);
-          // lrat_chain.clear (); done in search_assign
-        }
+      ticks++; // the clause is accessed below
 
-      } else {
-        assert (w.clause->size > 2);
+      assert (watched (w)->size > 2);
 
-        if (conflict)
-          break; // Stop if there was a binary conflict already.
+      // The cache line with the clause data is forced to be loaded here
+      // and thus this first memory access below is the real hot-spot of
+      // the solver.  Note, that this check is positive very rarely and
+      // thus branch prediction should be almost perfect here.
 
-        // The cache line with the clause data is forced to be loaded here
-        // and thus this first memory access below is the real hot-spot of
-        // the solver.  Note, that this check is positive very rarely and
-        // thus branch prediction should be almost perfect here.
+      if (watched (w)->garbage) {
+        j--;
+        continue;
+      }
 
-        if (w.clause->garbage) {
-          j--;
-          continue;
-        }
+      literal_iterator lits = watched (w)->begin ();
 
-        literal_iterator lits = w.clause->begin ();
+      // Simplify code by forcing 'lit' to be the second literal in the
+      // clause.  This goes back to MiniSAT.  We use a branch-less version
+      // for conditionally swapping the first two literals, since it
+      // turned out to be substantially faster than this one
+      //
+      //  if (lits[0] == lit) swap (lits[0], lits[1]);
+      //
+      // which achieves the same effect, but needs a branch.
+      //
+      const int other = lits[0] ^ lits[1] ^ lit;
+      const signed char u = val (other); // value of the other watch
 
-        // Simplify code by forcing 'lit' to be the second literal in the
-        // clause.  This goes back to MiniSAT.  We use a branch-less version
-        // for conditionally swapping the first two literals, since it
-        // turned out to be substantially faster than this one
-        //
-        //  if (lits[0] == lit) swap (lits[0], lits[1]);
-        //
-        // which achieves the same effect, but needs a branch.
-        //
-        const int other = lits[0] ^ lits[1] ^ lit;
-        const signed char u = val (other); // value of the other watch
+      if (u > 0)
+        j[-1].blit = other; // satisfied, just replace blit
+      else {
 
-        if (u > 0)
-          j[-1].blit = other; // satisfied, just replace blit
-        else {
+        // This follows Ian Gent's (JAIR'13) idea of saving the position
+        // of the last watch replacement.  In essence it needs two copies
+        // of the default search for a watch replacement (in essence the
+        // code in the 'if (v < 0) { ... }' block below), one starting at
+        // the saved position until the end of the clause and then if that
+        // one failed to find a replacement another one starting at the
+        // first non-watched literal until the saved position.
 
-          // This follows Ian Gent's (JAIR'13) idea of saving the position
-          // of the last watch replacement.  In essence it needs two copies
-          // of the default search for a watch replacement (in essence the
-          // code in the 'if (v < 0) { ... }' block below), one starting at
-          // the saved position until the end of the clause and then if that
-          // one failed to find a replacement another one starting at the
-          // first non-watched literal until the saved position.
-
-          const int size = w.clause->size;
-          const literal_iterator middle = lits + w.clause->pos;
-          const const_literal_iterator end = lits + size;
-          literal_iterator k = middle;
+        const int size = watched (w)->size;
+        const literal_iterator middle = lits + watched (w)->pos;
+        const const_literal_iterator end = lits + size;
+        literal_iterator k = middle;
 
-          // Find replacement watch 'r' at position 'k' with value 'v'.
+        // Find replacement watch 'r' at position 'k' with value 'v'.
 
-          int r = 0;
-          signed char v = -1;
+        int r = 0;
+        signed char v = -1;
 
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+        k = find_replacement (k, end);
+        if (k != end)
+          v = val (r = *k);
 
-          if (v < 0) { // need second search starting at the head?
+        if (v < 0) { // need second search starting at the head?
 
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
+          k = lits + 2;
+          assert (watched (w)->pos <= size);
+          k = find_replacement (k, middle);
+          if (k != middle)
+            v = val (r = *k);
+        }
 
-          w.clause->pos = k - lits; // always save position
+        watched (w)->pos = k - lits; // always save position
 
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+        assert (lits + 2 <= k), assert (k <= watched (w)->end ());
 
-          if (v > 0) {
+        if (v > 0) {
 
-            // Replacement satisfied, so just replace 'blit'.
+          // Replacement satisfied, so just replace 'blit'.
 
-            j[-1].blit = r;
+          j[-1].blit = r;
 
-          } else if (!v) {
+        } else if (!v) {
 
-            // Found new unassigned replacement literal to be watched.
+          // Found new unassigned replacement literal to be watched.
 
-            LOG (w.clause, "unwatch %d in", lit);
+          LOG (watched (w), "unwatch %d in", lit);
 
-            lits[0] = other;
-            lits[1] = r;
-            *k = lit;
+          lits[0] = other;
+          lits[1] = r;
+          *k = lit;
 
-            watch_literal (r, lit, w.clause);
+          watch_literal (r, lit, watched (w));
 
-            j--; // Drop this watch from the watch list of 'lit'.
+          j--; // Drop this watch from the watch list of 'lit'.
 
-          } else if (!u) {
+        } else if (!u) {
 
-            assert (v < 0);
+          assert (v < 0);
 
-            // The other watch is unassigned ('!u') and all other literals
-            // assigned to false (still 'v < 0'), thus we found a unit.
-            //
-            build_chain_for_units (other, w.clause, 0);
-            search_assign (other, w.clause);
-            // lrat_chain.clear (); done in search_assign
+          // The other watch is unassigned ('!u') and all other literals
+          // assigned to false (still 'v < 0'), thus we found a unit.
+          //
+          if (with_lrat)
+            build_chain_for_units (other, watched (w), 0);
+          search_assign<with_lrat, with_external> (other, watched (w));
+          // lrat_chain.clear (); done in search_assign
 
-            // Similar code is in the implementation of the SAT'18 paper on
-            // chronological backtracking but in our experience, this code
-            // first does not really seem to be necessary for correctness,
-            // and further does not improve running time either.
-            //
-            if (opts.chrono > 1) {
+          // Similar code is in the implementation of the SAT'18 paper on
+          // chronological backtracking but in our experience, this code
+          // first does not really seem to be necessary for correctness,
+          // and further does not improve running time either.
+          //
+          if (opts.chrono > 1) {
 
-              const int other_level = var (other).level;
+            const int other_level = var (other).level;
 
-              if (other_level > var (lit).level) {
+            if (other_level > var (lit).level) {
 
-                // The assignment level of the new unit 'other' is larger
-                // than the assignment level of 'lit'.  Thus we should find
-                // another literal in the clause at that higher assignment
-                // level and watch that instead of 'lit'.
+              // The assignment level of the new unit 'other' is larger
+              // than the assignment level of 'lit'.  Thus we should find
+              // another literal in the clause at that higher assignment
+              // level and watch that instead of 'lit'.
 
-                assert (size > 2);
+              assert (size > 2);
 
-                int pos, s = 0;
+              int pos, s = 0;
 
-                for (pos = 2; pos < size; pos++)
-                  if (var (s = lits[pos]).level == other_level)
-                    break;
+              for (pos = 2; pos < size; pos++)
+                if (var (s = lits[pos]).level == other_level)
+                  break;
 
-                assert (s);
-                assert (pos < size);
+              assert (s);
+              assert (pos < size);
 
-                LOG (w.clause, "unwatch %d in", lit);
-                lits[pos] = lit;
-                lits[0] = other;
-                lits[1] = s;
-                watch_literal (s, other, w.clause);
+              LOG (watched (w), "unwatch %d in", lit);
+              lits[pos] = lit;
+              lits[0] = other;
+              lits[1] = s;
+              watch_literal (s, other, watched (w));
 
-                j--; // Drop this watch from the watch list of 'lit'.
-              }
+              j--; // Drop this watch from the watch list of 'lit'.
             }
-          } else {
+          }
+        } else {
 
-            assert (u < 0);
-            assert (v < 0);
+          assert (u < 0);
+          assert (v < 0);
 
-            // The other watch is assigned false ('u < 0') and all other
-            // literals as well (still 'v < 0'), thus we found a conflict.
+          // The other watch is assigned false ('u < 0') and all other
+          // literals as well (still 'v < 0'), thus we found a conflict.
 
-            conflict = w.clause;
-            break;
-          }
+          conflict = watched (w);
+          break;
         }
       }
     }
@@ -525,6 +724,7 @@ bool Internal::propagate () {
     // Avoid updating stats eagerly in the hot-spot of the solver.
     //
     stats.propagations.search += propagated - before;
+    stats.ticks.search += ticks;
 
     if (!conflict)
       no_conflict_until = propagated;
@@ -547,6 +747,22 @@ bool Internal::propagate () {
   return !conflict;
 }
 
+// Select the propagation kernel which matches the current configuration
+// (unless 'opts.specialize' is disabled).  This is a single well predicted
+// branch per call instead of checks for every propagated literal.
+
+bool Internal::propagate () {
+  if (opts.reimply)
+    return propagate_clean ();
+  if (!opts.specialize)
+    return propagate_kernel<true, true> ();
+  if (lrat)
+    return external_prop ? propagate_kernel<true, true> ()
+                         : propagate_kernel<true, false> ();
+  return external_prop ? propagate_kernel<false, true> ()
+                       : propagate_kernel<false, false> ();
+}
+
 /*------------------------------------------------------------------------*/
 
 void Internal::propergate () {
@@ -570,16 +786,12 @@ void Internal::propergate () {
 
       const Watch w = *j++ = *i++;
 
-      if (w.binary ()) {
-        assert (val (w.blit) > 0);
-        continue;
-      }
-      if (w.clause->garbage) {
+      if (watched (w)->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = watched (w)->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
@@ -588,8 +800,8 @@ void Internal::propergate () {
         continue;
       assert (u < 0);
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = watched (w)->size;
+      const literal_iterator middle = lits + watched (w)->pos;
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -601,23 +813,23 @@ void Internal::propergate () {
 
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (watched (w)->pos <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
 
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= watched (w)->end ());
+      watched (w)->pos = k - lits;
 
       assert (v > 0);
 
-      LOG (w.clause, "unwatch %d in", lit);
+      LOG (watched (w), "unwatch %d in", lit);
 
       lits[0] = other;
       lits[1] = r;
       *k = lit;
 
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, watched (w));
 
       j--;
     }
@@ -654,16 +866,12 @@ void Internal::propergate_reimply () {
 
       const Watch w = *j++ = *i++;
 
-      if (w.binary ()) {
-        assert (val (w.blit) > 0);
-        continue;
-      }
-      if (w.clause->garbage) {
+      if (watched (w)->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = watched (w)->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
@@ -672,8 +880,8 @@ void Internal::propergate_reimply () {
         continue;
       assert (u < 0);
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = watched (w)->size;
+      const literal_iterator middle = lits + watched (w)->pos;
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -685,23 +893,23 @@ void Internal::propergate_reimply () {
 
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (watched (w)->pos <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
 
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= watched (w)->end ());
+      watched (w)->pos = k - lits;
 
       assert (v > 0);
 
-      LOG (w.clause, "unwatch %d in", lit);
+      LOG (watched (w), "unwatch %d in", lit);
 
       lits[0] = other;
       lits[1] = r;
       *k = lit;
 
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, watched (w));
 
       j--;
     }
@@ -726,6 +934,7 @@ bool Internal::propagate_conflicts () {
   assert (opts.reimply);
 
   LOG ("propagating conflicts");
+  clear_conflict_levels ();
 
   const auto eoc = conflicts.end ();
   auto j = conflicts.begin ();
@@ -799,25 +1008,25 @@ bool Internal::propagate_conflicts () {
 
     if (first == f) {
       assert (second != s);
-      remove_watch (watches (s), c);
+      unwatch_literal (s, c);
       lits[1] = second;
       *spos = s;
       watch_literal (second, first, c);
     } else if (first == s) {
       assert (second != f);
-      remove_watch (watches (f), c);
+      unwatch_literal (f, c);
       lits[0] = second;
       *spos = f;
       watch_literal (second, first, c);
     } else if (second == f) {
       assert (first != s);
-      remove_watch (watches (s), c);
+      unwatch_literal (s, c);
       lits[1] = first;
       *fpos = s;
       watch_literal (first, second, c);
     } else if (second == s) {
       assert (first != f);
-      remove_watch (watches (f), c);
+      unwatch_literal (f, c);
       lits[0] = first;
       *fpos = f;
       watch_literal (first, second, c);
@@ -848,34 +1057,37 @@ inline int Internal::next_propagation_level (int last) {
   assert (opts.reimply);
   if (last == -1 && propagated < trail.size ())
     return 0;
-  for (int l = last; l < level; l++) {
-    if (l < 0)
-      continue;
-    assert (l >= 0 && trails.size () >= (size_t) l);
-    if (multitrail[l] < trails[l].size ()) {
+  assert (level == trails.size ());
+  const Trails::Segment *s = trails.segments.data ();
+  for (int l = last < 0 ? 0 : last; l < level; l++)
+    if (s[l].propagated < s[l].size)
       return l + 1;
-    }
-  }
   return level;
 }
 
 // returns a conflict of conflicting_level at most l
 //
+// The conflicting levels of pending conflicts are kept in 'conflict_levels'
+// and pending conflicts are put into buckets by level, together with the
+// position of the first conflict with the lowest level (see 'trail.cpp').
+// Thus finding the lowest conflict takes constant time instead of computing
+// the level of all pending conflicts on every call.  If the last conflict
+// has the lowest level it is preferred as before.
+//
 inline Clause *Internal::propagation_conflict (int l, Clause *c) {
-  if (c)
+  if (c) {
     conflicts.push_back (c);
-  else if (conflicts.empty ())
+    push_conflict_level (conflicts.size () - 1);
+  } else if (conflicts.empty ())
     return 0;
-  else
+  assert (conflicts.size () == conflict_levels.size ());
+  assert (lowest_conflict < conflicts.size ());
+  const int conf = conflict_levels[lowest_conflict];
+  if (conflict_levels.back () == conf)
     c = conflicts.back ();
-  int conf = conflicting_level (c);
-  for (auto cl : conflicts) {
-    int ccl = conflicting_level (cl);
-    if (ccl < conf) {
-      c = cl;
-      conf = ccl;
-    }
-  }
+  else
+    c = conflicts[lowest_conflict];
+  assert (conflicting_level (c) == conf);
   if (conf <= l || l < 0)
     return c;
   return 0;
@@ -898,11 +1110,8 @@ bool Internal::propagate_multitrail () {
 
 #ifndef NDEBUG
   assert (!multitrail_dirty || (size_t) propagated == trail.size ());
-  if (multitrail_dirty) {
-    for (int i = 0; i < multitrail_dirty - 1; i++) {
-      assert ((size_t) multitrail[i] == trails[i].size ());
-    }
-  }
+  for (int l = 1; l < multitrail_dirty; l++)
+    assert (trails.segment (l).propagated == trails.segment (l).size);
 #endif
 
   // we can start propagation at level multitrail_dirty
@@ -918,21 +1127,61 @@ bool Internal::propagate_multitrail () {
     if (conflict)
       break;
     LOG ("PROPAGATION on level %d", proplevel);
-    const auto &t = next_trail (proplevel);
     int64_t before = next_propagated (proplevel);
-    size_t current = before;
-    while (!conflict && current != t->size ()) {
-      assert (opts.reimply || t == &trail);
-      LOG ("propagating level %d from %" PRId64 " to %zu", proplevel,
-           before, t->size ());
-
-      assert (current < t->size ());
-      const int lit = -(*t)[current++];
+    int current = before;
+    int64_t ticks = 0;
+    while (!conflict && current != trail_size (proplevel)) {
+      LOG ("propagating level %d from %" PRId64 " to %d", proplevel,
+           before, trail_size (proplevel));
+
+      assert (current < trail_size (proplevel));
+      const int lit = -trail_lit (proplevel, current++);
       if (var (lit).level < proplevel)
         continue;
 
       LOG ("propagating %d", -lit);
+
+      if (!saved_trail.empty ()) {
+        const signed char tmp = val (saved_trail.head ());
+        if (tmp > 0)
+          replay_saved_trail<true, true> (proplevel);
+        else if (tmp < 0)
+          saved_trail.clear (); // Saved trail diverged.
+      }
+
+      ticks += 1 + cache_lines (bwatches (lit));
+
+      for (const auto &w : bwatches (lit)) {
+
+        const signed char b = val (w.blit);
+        int l = var (w.blit).level;
+        bool repair = l > proplevel;
+        int multisat = w.blit * (repair) * (b > 0); // multitrailrepair mode
+
+        if (b > 0 && !multisat)
+          continue; // other literal satisfied
+
+        // Garbage binary clauses are not skipped (see 'propagate').
+
+        if (multisat) {
+          assert (b > 0);
+          // fix missed implication by elevating w.blit
+          elevate_lit (w.blit, watched (w));
+        } else if (b < 0)
+          conflict = propagation_conflict (
+              proplevel, watched (w)); // but continue ...
+        else {
+          build_chain_for_units (w.blit, watched (w), 0);
+          search_assign (w.blit, watched (w));
+          // lrat_chain.clear (); done in search_assign
+        }
+      }
+
+      if (conflict)
+        break; // Stop if there was a binary conflict already.
+
       Watches &ws = watches (lit);
+      ticks += cache_lines (ws);
 
       const const_watch_iterator eow = ws.end ();
       watch_iterator j = ws.begin ();
@@ -949,279 +1198,235 @@ bool Internal::propagate_multitrail () {
         if (b > 0 && !multisat)
           continue; // blocking literal satisfied
 
-        if (w.binary ()) {
+        ticks++; // the clause is accessed below
 
-          // In principle we can ignore garbage binary clauses too, but that
-          // would require to dereference the clause pointer all the time
-          // with
-          //
-          // if (w.clause->garbage) { j--; continue; } // (*)
-          //
-          // This is too costly.  It is however necessary to produce correct
-          // proof traces if binary clauses are traced to be deleted ('d
-          // ...' line) immediately as soon they are marked as garbage.
-          // Actually finding instances where this happens is pretty
-          // difficult (six parallel fuzzing jobs in parallel took an hour),
-          // but it does occur.  Our strategy to avoid generating incorrect
-          // proofs now is to delay tracing the deletion of binary clauses
-          // marked as garbage until they are really deleted from memory.
-          // For large clauses this is not necessary since we have to access
-          // the clause anyhow.
-          //
-          // Thanks go to Mathias Fleury, who wanted me to explain why the
-          // line '(*)' above was in the code. Removing it actually really
-          // improved running times and thus I tried to find concrete
-          // instances where this happens (which I found), and then
-          // implemented the described fix.
-
-          // Binary clauses are treated separately since they do not require
-          // to access the clause at all (only during conflict analysis, and
-          // there also only to simplify the code).
-
-          if (multisat) {
-            assert (b > 0);
-            // fix missed implication by elevating w.blit
-            elevate_lit (w.blit, w.clause);
-          } else if (b < 0)
-            conflict = propagation_conflict (proplevel,
-                                             w.clause); // but continue ...
-          else {
-            build_chain_for_units (w.blit, w.clause, 0);
-            search_assign (w.blit, w.clause);
-            // lrat_chain.clear (); done in search_assign
-          }
+        // The cache line with the clause data is forced to be loaded here
+        // and thus this first memory access below is the real hot-spot of
+        // the solver.  Note, that this check is positive very rarely and
+        // thus branch prediction should be almost perfect here.
 
-        } else {
+        if (watched (w)->garbage) {
+          j--;
+          continue;
+        }
 
-          if (conflict)
-            break; // Stop if there was a binary conflict already.
+        literal_iterator lits = watched (w)->begin ();
 
-          // The cache line with the clause data is forced to be loaded here
-          // and thus this first memory access below is the real hot-spot of
-          // the solver.  Note, that this check is positive very rarely and
-          // thus branch prediction should be almost perfect here.
+        // Simplify code by forcing 'lit' to be the second literal in the
+        // clause.  This goes back to MiniSAT.  We use a branch-less
+        // version for conditionally swapping the first two literals,
+        // since it turned out to be substantially faster than this one
+        //
+        //  if (lits[0] == lit) swap (lits[0], lits[1]);
+        //
+        // which achieves the same effect, but needs a branch.
+        //
+        const int other = lits[0] ^ lits[1] ^ lit;
+        const signed char u = val (other); // value of the other watch
+        l = var (other).level;
+        repair = l > proplevel;
+        multisat = other * (repair) * (u > 0); // multitrail mode
 
-          if (w.clause->garbage) {
-            j--;
-            continue;
-          }
+        if (u > 0 && !multisat)
+          j[-1].blit = other; // satisfied, just replace blit
+        else {
 
-          literal_iterator lits = w.clause->begin ();
+          // This follows Ian Gent's (JAIR'13) idea of saving the position
+          // of the last watch replacement.  In essence it needs two
+          // copies of the default search for a watch replacement (in
+          // essence the code in the 'if (v < 0) { ... }' block below),
+          // one starting at the saved position until the end of the
+          // clause and then if that one failed to find a replacement
+          // another one starting at the first non-watched literal until
+          // the saved position.
+
+          const int size = watched (w)->size;
+          const literal_iterator middle = lits + watched (w)->pos;
+          const const_literal_iterator end = lits + size;
+          literal_iterator k = middle;
 
-          // Simplify code by forcing 'lit' to be the second literal in the
-          // clause.  This goes back to MiniSAT.  We use a branch-less
-          // version for conditionally swapping the first two literals,
-          // since it turned out to be substantially faster than this one
-          //
-          //  if (lits[0] == lit) swap (lits[0], lits[1]);
-          //
-          // which achieves the same effect, but needs a branch.
-          //
-          const int other = lits[0] ^ lits[1] ^ lit;
-          const signed char u = val (other); // value of the other watch
-          l = var (other).level;
-          repair = l > proplevel;
-          multisat = other * (repair) * (u > 0); // multitrail mode
-
-          if (u > 0 && !multisat)
-            j[-1].blit = other; // satisfied, just replace blit
-          else {
-
-            // This follows Ian Gent's (JAIR'13) idea of saving the position
-            // of the last watch replacement.  In essence it needs two
-            // copies of the default search for a watch replacement (in
-            // essence the code in the 'if (v < 0) { ... }' block below),
-            // one starting at the saved position until the end of the
-            // clause and then if that one failed to find a replacement
-            // another one starting at the first non-watched literal until
-            // the saved position.
-
-            const int size = w.clause->size;
-            const literal_iterator middle = lits + w.clause->pos;
-            const const_literal_iterator end = lits + size;
-            literal_iterator k = middle;
-
-            // Find replacement watch 'r' at position 'k' with value 'v'.
-
-            int r = 0;
-            signed char v = -1;
-
-            while (k != end && (v = val (r = *k)) < 0)
-              k++;
-
-            if (v < 0) { // need second search starting at the head?
-
-              k = lits + 2;
-              assert (w.clause->pos <= size);
-              while (k != middle && (v = val (r = *k)) < 0)
-                k++;
-            }
+          // Find replacement watch 'r' at position 'k' with value 'v'.
 
-            w.clause->pos = k - lits; // always save position
-
-            assert (lits + 2 <= k), assert (k <= w.clause->end ());
-
-            if (v > 0) {
-              // check if w.clause is unisat
-              // if it is elevate literal
-              // fix watches
-              // the watch for lit has to be changed in case
-              // var (lit).level < var (x).level for all positively assigned
-              // literals x.
-              // for other similarly, but only if var (other).level <=
-              // proplevel and if var (other).level == proplevel then only
-              // if var (other).trail < var (lit).trail there is a high
-              // chance that this cannot happen...
-              if (!multisat) {
-                literal_iterator j = lits;
-                for (; j < end; j++) {
-                  int literal = *j;
-                  if (literal == r)
-                    continue;
-                  const auto tmp = val (literal);
-                  if (tmp < 0)
-                    continue;
-                  multisat = literal;
-                  break;
-                }
-              }
-              if (!multisat) {
-                // potentially elevating r...
-                elevate_lit (r, w.clause);
-                multisat = other; // instead we could search for a better
-                                  // blit (one with level == r.level)
-              }
-              if (multisat) {
-                // replace watch
-                LOG (w.clause, "unwatch %d in", lit);
+          int r = 0;
+          signed char v = -1;
 
-                lits[0] = other;
-                lits[1] = r;
-                *k = lit;
+          k = find_replacement (k, end);
+          if (k != end)
+            v = val (r = *k);
 
-                watch_literal (r, multisat, w.clause);
+          if (v < 0) { // need second search starting at the head?
 
-                j--; // Drop this watch from the watch list of 'lit'.
-              } else
-                // Replacement satisfied, so just replace 'blit'.
-                j[-1].blit = r;
+            k = lits + 2;
+            assert (watched (w)->pos <= size);
+            k = find_replacement (k, middle);
+            if (k != middle)
+              v = val (r = *k);
+          }
 
-            } else if (!v) {
+          watched (w)->pos = k - lits; // always save position
 
-              // Found new unassigned replacement literal to be watched.
+          assert (lits + 2 <= k), assert (k <= watched (w)->end ());
 
-              LOG (w.clause, "unwatch %d in", lit);
+          if (v > 0) {
+            // check if watched (w) is unisat
+            // if it is elevate literal
+            // fix watches
+            // the watch for lit has to be changed in case
+            // var (lit).level < var (x).level for all positively assigned
+            // literals x.
+            // for other similarly, but only if var (other).level <=
+            // proplevel and if var (other).level == proplevel then only
+            // if var (other).trail < var (lit).trail there is a high
+            // chance that this cannot happen...
+            if (!multisat) {
+              literal_iterator j = lits;
+              for (; j < end; j++) {
+                int literal = *j;
+                if (literal == r)
+                  continue;
+                const auto tmp = val (literal);
+                if (tmp < 0)
+                  continue;
+                multisat = literal;
+                break;
+              }
+            }
+            if (!multisat) {
+              // potentially elevating r...
+              elevate_lit (r, watched (w));
+              multisat = other; // instead we could search for a better
+                                // blit (one with level == r.level)
+            }
+            if (multisat) {
+              // replace watch
+              LOG (watched (w), "unwatch %d in", lit);
 
               lits[0] = other;
               lits[1] = r;
               *k = lit;
 
-              watch_literal (r, lit, w.clause);
+              watch_literal (r, multisat, watched (w));
 
               j--; // Drop this watch from the watch list of 'lit'.
+            } else
+              // Replacement satisfied, so just replace 'blit'.
+              j[-1].blit = r;
 
-            } else if (!u) {
+          } else if (!v) {
 
-              assert (v < 0);
+            // Found new unassigned replacement literal to be watched.
 
-              // The other watch is unassigned ('!u') and all other literals
-              // assigned to false (still 'v < 0'), thus we found a unit.
-              //
-              build_chain_for_units (other, w.clause, 0);
-              search_assign (other, w.clause);
-              // lrat_chain.clear (); done in search_assign
+            LOG (watched (w), "unwatch %d in", lit);
 
-              // we need to change the blocking lit anyways
-              // not really neccessary
-              j[-1].blit = other;
+            lits[0] = other;
+            lits[1] = r;
+            *k = lit;
+
+            watch_literal (r, lit, watched (w));
 
-              // Similar code is in the implementation of the SAT'18 paper
-              // on chronological backtracking but in our experience, this
-              // code first does not really seem to be necessary for
-              // correctness, and further does not improve running time
-              // either.
-              //
-              // this is actually necessary to preserve the invariant for
-              // opts.reimply. otherwise the watches break if we
-              // backtrack.
+            j--; // Drop this watch from the watch list of 'lit'.
+
+          } else if (!u) {
 
-              if (opts.reimply ||
-                  opts.chrono > 1) { // ... always do some variant ...
+            assert (v < 0);
+
+            // The other watch is unassigned ('!u') and all other literals
+            // assigned to false (still 'v < 0'), thus we found a unit.
+            //
+            build_chain_for_units (other, watched (w), 0);
+            search_assign (other, watched (w));
+            // lrat_chain.clear (); done in search_assign
 
-                const int other_level = var (other).level;
+            // we need to change the blocking lit anyways
+            // not really neccessary
+            j[-1].blit = other;
 
-                if (other_level > var (lit).level) {
+            // Similar code is in the implementation of the SAT'18 paper
+            // on chronological backtracking but in our experience, this
+            // code first does not really seem to be necessary for
+            // correctness, and further does not improve running time
+            // either.
+            //
+            // this is actually necessary to preserve the invariant for
+            // opts.reimply. otherwise the watches break if we
+            // backtrack.
 
-                  // The assignment level of the new unit 'other' is larger
-                  // than the assignment level of 'lit'.  Thus we should
-                  // find another literal in the clause at that higher
-                  // assignment level and watch that instead of 'lit'.
+            if (opts.reimply ||
+                opts.chrono > 1) { // ... always do some variant ...
 
-                  assert (size > 2);
+              const int other_level = var (other).level;
 
-                  int pos, s = 0;
+              if (other_level > var (lit).level) {
 
-                  for (pos = 2; pos < size; pos++)
-                    if (var (s = lits[pos]).level == other_level)
-                      break;
+                // The assignment level of the new unit 'other' is larger
+                // than the assignment level of 'lit'.  Thus we should
+                // find another literal in the clause at that higher
+                // assignment level and watch that instead of 'lit'.
 
-                  assert (s);
-                  assert (pos < size);
+                assert (size > 2);
 
-                  LOG (w.clause, "unwatch %d in", lit);
-                  lits[pos] = lit;
-                  lits[0] = other;
-                  lits[1] = s;
-                  watch_literal (s, other, w.clause);
+                int pos, s = 0;
 
-                  j--; // Drop this watch from the watch list of 'lit'.
-                }
-              }
-            } else if (u > 0) {
-              assert (v < 0);
-              assert (multisat);
-
-              // we might have to elevate...
-              elevate_lit (other, w.clause);
-
-              // now other_level might have changed
-              int other_level = var (other).level;
-
-              // if we elevated to proplevel we can just change blit to
-              // other
-              assert (other_level >= proplevel);
-              if (other_level == proplevel) {
-                j[-1].blit = other;
-              } else {          // otherwise we search for a new watch
-                int pos, s = 0; // which is guaranteed to exist because
-                                // of elevation.
-                for (pos = 2; pos < size; pos++) {
-                  if (var (s = lits[pos]).level >= other_level)
+                for (pos = 2; pos < size; pos++)
+                  if (var (s = lits[pos]).level == other_level)
                     break;
-                }
+
                 assert (s);
                 assert (pos < size);
 
-                LOG (w.clause, "unwatch %d in", lit);
+                LOG (watched (w), "unwatch %d in", lit);
                 lits[pos] = lit;
                 lits[0] = other;
                 lits[1] = s;
-                watch_literal (s, other, w.clause);
+                watch_literal (s, other, watched (w));
 
                 j--; // Drop this watch from the watch list of 'lit'.
               }
-            } else {
+            }
+          } else if (u > 0) {
+            assert (v < 0);
+            assert (multisat);
 
-              assert (u < 0);
-              assert (v < 0);
+            // we might have to elevate...
+            elevate_lit (other, watched (w));
 
-              // The other watch is assigned false ('u < 0') and all other
-              // literals as well (still 'v < 0'), thus we found a conflict.
+            // now other_level might have changed
+            int other_level = var (other).level;
 
-              conflict = propagation_conflict (proplevel, w.clause);
-              if (conflict)
-                break;
+            // if we elevated to proplevel we can just change blit to
+            // other
+            assert (other_level >= proplevel);
+            if (other_level == proplevel) {
+              j[-1].blit = other;
+            } else {          // otherwise we search for a new watch
+              int pos, s = 0; // which is guaranteed to exist because
+                              // of elevation.
+              for (pos = 2; pos < size; pos++) {
+                if (var (s = lits[pos]).level >= other_level)
+                  break;
+              }
+              assert (s);
+              assert (pos < size);
+
+              LOG (watched (w), "unwatch %d in", lit);
+              lits[pos] = lit;
+              lits[0] = other;
+              lits[1] = s;
+              watch_literal (s, other, watched (w));
+
+              j--; // Drop this watch from the watch list of 'lit'.
             }
+          } else {
+
+            assert (u < 0);
+            assert (v < 0);
+
+            // The other watch is assigned false ('u < 0') and all other
+            // literals as well (still 'v < 0'), thus we found a conflict.
+
+            conflict = propagation_conflict (proplevel, watched (w));
+            if (conflict)
+              break;
           }
         }
       }
@@ -1239,6 +1444,7 @@ bool Internal::propagate_multitrail () {
     if (!searching_lucky_phases) {
       stats.propagations.search += current - before;
       stats.propagations.dirty += current - before;
+      stats.ticks.search += ticks;
     }
   }
   if (!conflict) {
@@ -1287,21 +1493,18 @@ bool Internal::propagate_multitrail () {
 //
 inline int Internal::trails_sizes (int l) {
   assert (opts.reimply);
-  int res = trail.size ();
-  // TODO: switch code here
-  /*
-  for (int i = 0; i < l; i++) {
-    for (auto & lit : (trails[i])) {
-      if (lit && var (lit).level == i+1)
-        res ++;
-    }
-  }
-  */
-  // not precise...
-  for (int i = 0; i < l; i++) {
-    res += trails[i].size ();
-  }
-  return res;
+  // Segments are allocated at the top of the flat buffer (see 'trails.hpp'),
+  // thus the base of the segment of level 'l + 1' is the number of literals
+  // on levels up to 'l'.  It is not precise, since elevated literals are
+  // counted on every level they have been pushed to and moved segments leave
+  // gaps, but it never needs to exceed the number of assigned literals.
+  //
+  if (l <= 0)
+    return trail.size ();
+  if (l >= trails.size ()) // Probing and lookahead do not push levels.
+    return num_assigned;
+  const size_t res = trail.size () + trails.segments[l].base;
+  return min (res, num_assigned);
 }
 
 bool Internal::propagate_clean () {
@@ -1323,15 +1526,29 @@ bool Internal::propagate_clean () {
 
 #ifndef NDEBUG
   assert (!level || (size_t) propagated == trail.size ());
-  if (level) {
-    for (int i = 0; i < level - 1; i++) {
-      assert ((size_t) multitrail[i] == trails[i].size ());
-    }
-  }
+  for (int l = 1; l < level; l++)
+    assert (trails.segment (l).propagated == trails.segment (l).size);
 #endif
 
   assert (opts.reimply && multitrail_dirty == level && conflicts.empty ());
 
+  // See 'propagate' for the selection of kernels.
+  //
+  if (!opts.specialize)
+    return propagate_clean_kernel<true, true> ();
+  if (lrat)
+    return external_prop ? propagate_clean_kernel<true, true> ()
+                         : propagate_clean_kernel<true, false> ();
+  return external_prop ? propagate_clean_kernel<false, true> ()
+                       : propagate_clean_kernel<false, false> ();
+}
+
+// Propagate the current level in 'opts.reimply' mode after all other
+// levels have been propagated ('multitrail_dirty == level').
+
+template <bool with_lrat, bool with_external>
+bool Internal::propagate_clean_kernel () {
+
   if (level)
     require_mode (SEARCH);
   assert (!unsat);
@@ -1342,18 +1559,56 @@ bool Internal::propagate_clean () {
   // delay until propagation ran to completion.
   //
 
+  const ptrdiff_t distance = opts.prefetch; // see 'propagate_kernel'
+
   LOG ("PROPAGATION clean on level %d", level);
   int64_t before = next_propagated (level);
-  size_t current = before;
-  const auto &t = next_trail (level);
-  while (!conflict && current != t->size ()) {
+  int current = before;
+  int64_t ticks = 0;
+  while (!conflict && current != trail_size (level)) {
 
-    const int lit = -(*t)[current++];
+    const int lit = -trail_lit (level, current++);
     if (var (lit).level < level)
       continue;
 
     LOG ("propagating %d", -lit);
+
+    if (!saved_trail.empty ()) {
+      const signed char tmp = val (saved_trail.head ());
+      if (tmp > 0)
+        replay_saved_trail<with_lrat, with_external> (level);
+      else if (tmp < 0)
+        saved_trail.clear (); // Saved trail diverged.
+      if (conflict)
+        break;
+    }
+
+    ticks += 1 + cache_lines (bwatches (lit));
+
+    for (const auto &w : bwatches (lit)) {
+
+      const signed char b = val (w.blit);
+
+      if (b > 0)
+        continue; // other literal satisfied
+
+      // Garbage binary clauses are not skipped (see 'propagate').
+
+      if (b < 0)
+        conflict = watched (w); // but continue ...
+      else {
+        if (with_lrat)
+          build_chain_for_units (w.blit, watched (w), 0);
+        search_assign<with_lrat, with_external> (w.blit, watched (w));
+        // lrat_chain.clear (); done in search_assign
+      }
+    }
+
+    if (conflict)
+      break; // Stop if there was a binary conflict already.
+
     Watches &ws = watches (lit);
+    ticks += cache_lines (ws);
 
     const const_watch_iterator eow = ws.end ();
     watch_iterator j = ws.begin ();
@@ -1362,158 +1617,129 @@ bool Internal::propagate_clean () {
     while (i != eow) {
 
       const Watch w = *j++ = *i++;
+
+      if (distance && distance <= eow - i) { // see 'propagate_kernel'
+        const Watch &ahead = i[distance - 1];
+        if (val (ahead.blit) <= 0)
+          __builtin_prefetch (watched (ahead), 1, 1);
+      }
+
       const signed char b = val (w.blit);
 
       if (b > 0)
         continue; // blocking literal satisfied
 
-      if (w.binary ()) {
-
-        // In principle we can ignore garbage binary clauses too, but that
-        // would require to dereference the clause pointer all the time with
-        //
-        // if (w.clause->garbage) { j--; continue; } // (*)
-        //
-        // This is too costly.  It is however necessary to produce correct
-        // proof traces if binary clauses are traced to be deleted ('d ...'
-        // line) immediately as soon they are marked as garbage.  Actually
-        // finding instances where this happens is pretty difficult (six
-        // parallel fuzzing jobs in parallel took an hour), but it does
-        // occur.  Our strategy to avoid generating incorrect proofs now is
-        // to delay tracing the deletion of binary clauses marked as garbage
-        // until they are really deleted from memory.  For large clauses
-        // this is not necessary since we have to access the clause anyhow.
-        //
-        // Thanks go to Mathias Fleury, who wanted me to explain why the
-        // line '(*)' above was in the code. Removing it actually really
-        // improved running times and thus I tried to find concrete
-        // instances where this happens (which I found), and then
-        // implemented the described fix.
-
-        // Binary clauses are treated separately since they do not require
-        // to access the clause at all (only during conflict analysis, and
-        // there also only to simplify the code).
-
-        if (b < 0)
-          conflict = w.clause; // but continue ...
-        else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          search_assign (w.blit, w.clause);
-          // lrat_chain.clear (); done in search_assign
-        }
-
-      } else {
+      ticks++; // the clause is accessed below
 
-        if (conflict)
-          break; // Stop if there was a binary conflict already.
+      // The cache line with the clause data is forced to be loaded here
+      // and thus this first memory access below is the real hot-spot of
+      // the solver.  Note, that this check is positive very rarely and
+      // thus branch prediction should be almost perfect here.
 
-        // The cache line with the clause data is forced to be loaded here
-        // and thus this first memory access below is the real hot-spot of
-        // the solver.  Note, that this check is positive very rarely and
-        // thus branch prediction should be almost perfect here.
+      if (watched (w)->garbage) {
+        j--;
+        continue;
+      }
 
-        if (w.clause->garbage) {
-          j--;
-          continue;
-        }
+      literal_iterator lits = watched (w)->begin ();
 
-        literal_iterator lits = w.clause->begin ();
+      // Simplify code by forcing 'lit' to be the second literal in the
+      // clause.  This goes back to MiniSAT.  We use a branch-less version
+      // for conditionally swapping the first two literals, since it
+      // turned out to be substantially faster than this one
+      //
+      //  if (lits[0] == lit) swap (lits[0], lits[1]);
+      //
+      // which achieves the same effect, but needs a branch.
+      //
+      const int other = lits[0] ^ lits[1] ^ lit;
+      const signed char u = val (other); // value of the other watch
 
-        // Simplify code by forcing 'lit' to be the second literal in the
-        // clause.  This goes back to MiniSAT.  We use a branch-less version
-        // for conditionally swapping the first two literals, since it
-        // turned out to be substantially faster than this one
-        //
-        //  if (lits[0] == lit) swap (lits[0], lits[1]);
-        //
-        // which achieves the same effect, but needs a branch.
-        //
-        const int other = lits[0] ^ lits[1] ^ lit;
-        const signed char u = val (other); // value of the other watch
+      if (u > 0)
+        j[-1].blit = other; // satisfied, just replace blit
+      else {
 
-        if (u > 0)
-          j[-1].blit = other; // satisfied, just replace blit
-        else {
+        // This follows Ian Gent's (JAIR'13) idea of saving the position
+        // of the last watch replacement.  In essence it needs two copies
+        // of the default search for a watch replacement (in essence the
+        // code in the 'if (v < 0) { ... }' block below), one starting at
+        // the saved position until the end of the clause and then if that
+        // one failed to find a replacement another one starting at the
+        // first non-watched literal until the saved position.
 
-          // This follows Ian Gent's (JAIR'13) idea of saving the position
-          // of the last watch replacement.  In essence it needs two copies
-          // of the default search for a watch replacement (in essence the
-          // code in the 'if (v < 0) { ... }' block below), one starting at
-          // the saved position until the end of the clause and then if that
-          // one failed to find a replacement another one starting at the
-          // first non-watched literal until the saved position.
-
-          const int size = w.clause->size;
-          const literal_iterator middle = lits + w.clause->pos;
-          const const_literal_iterator end = lits + size;
-          literal_iterator k = middle;
+        const int size = watched (w)->size;
+        const literal_iterator middle = lits + watched (w)->pos;
+        const const_literal_iterator end = lits + size;
+        literal_iterator k = middle;
 
-          // Find replacement watch 'r' at position 'k' with value 'v'.
+        // Find replacement watch 'r' at position 'k' with value 'v'.
 
-          int r = 0;
-          signed char v = -1;
+        int r = 0;
+        signed char v = -1;
 
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+        k = find_replacement (k, end);
+        if (k != end)
+          v = val (r = *k);
 
-          if (v < 0) { // need second search starting at the head?
+        if (v < 0) { // need second search starting at the head?
 
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
+          k = lits + 2;
+          assert (watched (w)->pos <= size);
+          k = find_replacement (k, middle);
+          if (k != middle)
+            v = val (r = *k);
+        }
 
-          w.clause->pos = k - lits; // always save position
+        watched (w)->pos = k - lits; // always save position
 
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+        assert (lits + 2 <= k), assert (k <= watched (w)->end ());
 
-          if (v > 0) {
+        if (v > 0) {
 
-            // Replacement satisfied, so just replace 'blit'.
+          // Replacement satisfied, so just replace 'blit'.
 
-            j[-1].blit = r;
+          j[-1].blit = r;
 
-          } else if (!v) {
+        } else if (!v) {
 
-            // Found new unassigned replacement literal to be watched.
+          // Found new unassigned replacement literal to be watched.
 
-            LOG (w.clause, "unwatch %d in", lit);
+          LOG (watched (w), "unwatch %d in", lit);
 
-            lits[0] = other;
-            lits[1] = r;
-            *k = lit;
+          lits[0] = other;
+          lits[1] = r;
+          *k = lit;
 
-            watch_literal (r, lit, w.clause);
+          watch_literal (r, lit, watched (w));
 
-            j--; // Drop this watch from the watch list of 'lit'.
+          j--; // Drop this watch from the watch list of 'lit'.
 
-          } else if (!u) {
+        } else if (!u) {
 
-            assert (v < 0);
+          assert (v < 0);
 
-            // The other watch is unassigned ('!u') and all other literals
-            // assigned to false (still 'v < 0'), thus we found a unit.
-            //
-            build_chain_for_units (other, w.clause, 0);
-            search_assign (other, w.clause);
-            // lrat_chain.clear (); done in search_assign
+          // The other watch is unassigned ('!u') and all other literals
+          // assigned to false (still 'v < 0'), thus we found a unit.
+          //
+          if (with_lrat)
+            build_chain_for_units (other, watched (w), 0);
+          search_assign<with_lrat, with_external> (other, watched (w));
+          // lrat_chain.clear (); done in search_assign
 
-            // commented code cannot happen
-            assert (var (lit).level == level);
-            assert (var (other).level == level);
+          // commented code cannot happen
+          assert (var (lit).level == level);
+          assert (var (other).level == level);
 
-          } else {
+        } else {
 
-            assert (u < 0);
-            assert (v < 0);
+          assert (u < 0);
+          assert (v < 0);
 
-            // The other watch is assigned false ('u < 0') and all other
-            // literals as well (still 'v < 0'), thus we found a conflict.
+          // The other watch is assigned false ('u < 0') and all other
+          // literals as well (still 'v < 0'), thus we found a conflict.
 
-            conflict = w.clause;
-            break;
-          }
+          conflict = watched (w);
+          break;
         }
       }
     }
@@ -1539,6 +1765,7 @@ bool Internal::propagate_clean () {
     //
     stats.propagations.search += current - before;
     stats.propagations.clean += current - before;
+    stats.ticks.search += ticks;
 
     if (!conflict) {
       no_conflict_until = num_assigned;
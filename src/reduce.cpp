@@ -61,21 +61,15 @@ void Internal::mark_clauses_to_be_flushed () {
 // IJCAI'09 paper and keep all low glue clauses limited by
 // 'options.keepglue' (typically '2').
 //
-// In earlier versions we pre-computed a 64-bit sort key per clause and
-// wrapped a pointer to the clause and the 64-bit sort key into a separate
-// data structure for sorting.  This was probably faster but awkward and
-// so we moved back to a simpler scheme which also uses 'stable_sort'
-// instead of 'rsort' below.  Sorting here is not a hot-spot anyhow.
-
-struct reduce_less_useful {
-  bool operator() (const Clause *c, const Clause *d) const {
-    if (c->glue > d->glue)
-      return true;
-    if (c->glue < d->glue)
-      return false;
-    return c->size > d->size;
-  }
-};
+// Earlier versions sorted all candidates with 'stable_sort' by decreasing
+// glue and then decreasing size and removed the first 'reducetarget'
+// percent of them.  With many millions of redundant clauses this sort
+// becomes noticeable.  However, we only need the cut-off, which is found
+// in linear time by counting candidates per glue and then for the glue at
+// the cut-off per size.  Candidates with the same glue and size as the
+// cut-off are removed in the order they occur in 'clauses', which gives
+// exactly the same selection as stable sorting, i.e., more recently
+// learned clauses are kept if they otherwise have the same glue and size.
 
 // This function implements the important reduction policy. It determines
 // which redundant clauses are considered not useful and thus will be
@@ -83,16 +77,15 @@ struct reduce_less_useful {
 
 void Internal::mark_useless_redundant_clauses_as_garbage () {
 
-  // We use a separate stack for sorting candidates for removal.  This uses
-  // (slightly) more memory but has the advantage to keep the relative order
-  // in 'clauses' intact, which actually due to using stable sorting goes
-  // into the candidate selection (more recently learned clauses are kept if
-  // they otherwise have the same glue and size).
+  // We use a separate stack for candidates for removal.  This uses
+  // (slightly) more memory but avoids traversing all clauses again.
 
   vector<Clause *> stack;
 
   stack.reserve (stats.current.redundant);
 
+  int max_glue = 0, max_size = 0;
+
   for (const auto &c : clauses) {
     if (!c->redundant)
       continue; // Keep irredundant.
@@ -115,10 +108,12 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
       continue; // Forced to keep (see above).
 
     stack.push_back (c);
+    if (c->glue > max_glue)
+      max_glue = c->glue;
+    if (c->size > max_size)
+      max_size = c->size;
   }
 
-  stable_sort (stack.begin (), stack.end (), reduce_less_useful ());
-
   size_t target = 1e-2 * opts.reducetarget * stack.size ();
 
   // This is defensive code, which I usually consider a bug, but here I am
@@ -131,25 +126,54 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
   PHASE ("reduce", stats.reductions, "reducing %zd clauses %.0f%%", target,
          percent (target, stats.current.redundant));
 
-  auto i = stack.begin ();
-  const auto t = i + target;
-  while (i != t) {
-    Clause *c = *i++;
-    LOG (c, "marking useless to be collected");
-    mark_garbage (c);
-    stats.reduced++;
-  }
+  // Find the cut-off glue and the number of candidates with larger glue.
+
+  vector<size_t> count (max (max_glue, max_size) + 1, 0);
+  for (const auto &c : stack)
+    count[c->glue]++;
+
+  int glue = max_glue;
+  size_t above = 0;
+  while (glue > 0 && above + count[glue] <= target)
+    above += count[glue--];
+
+  // Then the cut-off size among the candidates with the cut-off glue.
+
+  fill (count.begin (), count.end (), 0);
+  for (const auto &c : stack)
+    if (c->glue == glue)
+      count[c->size]++;
+
+  int size = max_size;
+  while (size > 0 && above + count[size] <= target)
+    above += count[size--];
+
+  assert (above <= target);
+  size_t remaining = target - above;
 
   lim.keptsize = lim.keptglue = 0;
 
-  const auto end = stack.end ();
-  for (i = t; i != end; i++) {
-    Clause *c = *i;
-    LOG (c, "keeping");
-    if (c->size > lim.keptsize)
-      lim.keptsize = c->size;
-    if (c->glue > lim.keptglue)
-      lim.keptglue = c->glue;
+  for (const auto &c : stack) {
+    bool useless;
+    if (c->glue != glue)
+      useless = (c->glue > glue);
+    else if (c->size != size)
+      useless = (c->size > size);
+    else if (remaining)
+      useless = true, remaining--;
+    else
+      useless = false;
+    if (useless) {
+      LOG (c, "marking useless to be collected");
+      mark_garbage (c);
+      stats.reduced++;
+    } else {
+      LOG (c, "keeping");
+      if (c->size > lim.keptsize)
+        lim.keptsize = c->size;
+      if (c->glue > lim.keptglue)
+        lim.keptglue = c->glue;
+    }
   }
 
   erase_vector (stack);
@@ -201,6 +225,8 @@ void Internal::reduce () {
   if (flush)
     stats.flush.count++;
 
+  const bool selective = !flush && selective_collecting ();
+
   if (!propagate_out_of_order_units ())
     goto DONE;
 
@@ -210,7 +236,10 @@ void Internal::reduce () {
     mark_clauses_to_be_flushed ();
   else
     mark_useless_redundant_clauses_as_garbage ();
-  garbage_collection ();
+  if (selective)
+    selective_collection ();
+  else
+    garbage_collection ();
 
   {
     int64_t delta = opts.reduceint * (stats.reductions + 1);
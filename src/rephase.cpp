@@ -89,10 +89,17 @@ char Internal::rephase_best () {
   return 'B';
 }
 
-// Trigger local search 'walk' in 'walk.cpp'.
+// Trigger local search 'walk' in 'walk.cpp' or adopt the phases found by
+// the background walkers (see 'walkers.cpp') if those are running.
 
 char Internal::rephase_walk () {
   stats.rephased.walk++;
+  if (walkers) {
+    PHASE ("rephase", stats.rephased.total,
+           "adopting phases of background local search");
+    restart_walkers ();
+    return 'W';
+  }
   PHASE ("rephase", stats.rephased.total,
          "starting local search to improve current phase");
   walk ();
@@ -22,6 +22,7 @@ F  backtracked after flipping phases
 B  backtracked after resetting to best phases
 W  backtracked after local search improved phases
 b  blocked clause elimination
+x  bounded variable addition
 G  before garbage collection
 C  after garbage collection
 /  compacted internal literals and remapped external to internal
@@ -221,6 +222,7 @@ void Internal::report (char type, int verbose) {
   case 'w':
   case 't':
   case 'b':
+  case 'x':
   case 'c':
     tout.green (false);
     break;
@@ -118,7 +118,10 @@ void Internal::restart () {
   if (stable)
     stats.restartstable++;
   LOG ("restart %" PRId64 "", stats.restarts);
-  backtrack (reuse_trail ());
+  if (external->importer && !proof && import_clauses ())
+    LOG ("restarting from root level after importing clauses");
+  else
+    backtrack (reuse_trail ());
 
   lim.restart = stats.conflicts + opts.restartint;
   LOG ("new restart limit at %" PRId64 " conflicts", lim.restart);
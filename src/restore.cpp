@@ -66,7 +66,7 @@ void External::restore_clause (const vector<int>::const_iterator &begin,
         internal->lrat_chain.push_back (id);
       }
     }
-    int ilit = internalize (*p);
+    int ilit = internalize (*p, true);
     if (irredundant_clause)
       internal->add_original_lit (ilit), internal->stats.restoredlits++;
   }
@@ -0,0 +1,50 @@
+#ifndef _saved_hpp_INCLUDED
+#define _saved_hpp_INCLUDED
+
+#include <cassert>
+#include <vector>
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Trail saving following the SAT'20 paper by Hickey and Bacchus.  At a
+// back-jump in 'analyze' the literals on the undone decision levels are
+// saved in trail order together with their reasons ('opts.trailsave').
+// Decisions (and literals without a proper reason clause) are saved with
+// a zero reason.  As soon as propagation (all kernels, including the one
+// for lower levels with 'opts.reimply') finds the literal at 'next'
+// assigned again, the implied literals following it are replayed (see
+// 'replay_saved_trail' in 'propagate.cpp') until the next saved decision,
+// which first has to be assigned again by the search.  If the literal at
+// 'next' is falsified instead, the search diverged and the saved trail is
+// dropped.  Since clauses might be deleted, saved trails are also dropped
+// during garbage collection.
+
+struct SavedTrail {
+
+  struct Entry {
+    int lit;
+    Clause *reason; // zero for decisions
+  };
+
+  std::vector<Entry> entries;
+  size_t next; // next entry to be replayed
+
+  SavedTrail () : next (0) {}
+
+  bool empty () const { return next == entries.size (); }
+  int head () const {
+    assert (!empty ());
+    return entries[next].lit;
+  }
+  void push (int lit, Clause *reason) { entries.push_back ({lit, reason}); }
+  void clear () {
+    entries.clear ();
+    next = 0;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -13,6 +13,15 @@ void Internal::init_scores (int old_max_var, int new_max_var) {
     scores.push_back (i + 1);
 }
 
+// The arity of the EVSIDS heap is only changed before search.
+
+void Internal::reshape_scores () {
+  if (scores.arity () == (unsigned) opts.heaparity)
+    return;
+  LOG ("reshaping EVSIDS heap to arity %d", (int) opts.heaparity);
+  scores.reshape (opts.heaparity);
+}
+
 // Shuffle the EVSIDS heap.
 
 void Internal::shuffle_scores () {
@@ -101,8 +101,7 @@ int inline Internal::shrink_literal (int lit, int blevel,
   f.poison = false;
   shrinkable.push_back (lit);
   if (opts.shrinkreap) { // different assertion for multitrail
-    assert (!opts.reimply || max_trail < trails[blevel - 1].size ());
-    assert (opts.reimply || max_trail < trail.size ());
+    assert (max_trail < (unsigned) trail_size (blevel));
     const unsigned dist = max_trail - v.trail;
     reap.push (dist);
   }
@@ -190,15 +189,13 @@ void Internal::push_literals_of_block (
 
 unsigned inline Internal::shrink_next (int blevel, unsigned &open,
                                        unsigned &max_trail) {
-  const auto &t = next_trail (blevel);
   if (opts.shrinkreap) {
     assert (!reap.empty ());
     const unsigned dist = reap.pop ();
     --open;
     assert (dist <= max_trail);
     const unsigned pos = max_trail - dist;
-    assert (pos < t->size ());
-    const int uip = (*t)[pos];
+    const int uip = trail_lit (blevel, pos);
     assert (val (uip) > 0);
     LOG ("trying to shrink literal %d at trail[%u]", uip, pos);
     return uip;
@@ -209,7 +206,7 @@ unsigned inline Internal::shrink_next (int blevel, unsigned &open,
 #endif
     do {
       assert (max_trail <= init_max_trail);
-      uip = (*t)[max_trail--];
+      uip = trail_lit (blevel, max_trail--);
     } while (!flags (uip).shrinkable);
     --open;
     LOG ("open is now %d, uip = %d", open, uip);
@@ -271,9 +268,8 @@ Internal::shrink_block (std::vector<int>::reverse_iterator &rbegin_lits,
 
   LOG ("trying to shrink %u literals on level %u", open, blevel);
 
-  const auto &t = next_trail (blevel);
-
-  LOG ("maximum trail position %zd on level %u", t->size (), blevel);
+  LOG ("maximum trail position %d on level %u", trail_size (blevel),
+       blevel);
   if (opts.shrinkreap)
     LOG ("shrinking up to %u", max_trail);
 #endif
@@ -301,6 +301,27 @@ void Solver::trace_api_call (const char *s0, const char *s1, int i2) const {
 //
 static bool tracing_api_calls_through_environment_variable_method;
 
+// Imported clauses are not given through API calls but obtained from the
+// connected importer during 'solve'.  While tracing the importer is wrapped
+// to write these clauses as 'import' lines to the trace.  Accordingly they
+// follow the 'solve' line and 'mobical' hands them to its mock importer
+// before executing that 'solve' (as it does with 'lemma' lines).
+
+class TracingImporter : public Importer {
+  Importer *importer;
+  FILE *file;
+
+public:
+  TracingImporter (Importer *i, FILE *f) : importer (i), file (f) {}
+  bool importing () { return importer->importing (); }
+  int import () {
+    const int lit = importer->import ();
+    fprintf (file, "import %d\n", lit);
+    fflush (file);
+    return lit;
+  }
+};
+
 /*------------------------------------------------------------------------*/
 #else // NTRACING
 /*------------------------------------------------------------------------*/
@@ -334,6 +355,7 @@ Solver::Solver () {
     close_trace_api_file = false;
     trace_api_file = 0;
   }
+  tracing_importer = 0;
 #endif
 
   adding_clause = false;
@@ -368,6 +390,7 @@ Solver::~Solver () {
   delete external;
 
 #ifndef NTRACING
+  delete tracing_importer;
   if (close_trace_api_file) {
     close_trace_api_file = false;
     assert (trace_api_file);
@@ -397,6 +420,8 @@ int Solver::vars () {
   TRACE ("vars");
   REQUIRE_VALID_OR_SOLVING_STATE ();
   int res = external->max_var;
+  while (res && external->introduced[res]) // hidden from the user
+    res--;
   LOG_API_CALL_RETURNS ("vars", res);
   return res;
 }
@@ -860,6 +885,46 @@ void Solver::disconnect_learner () {
   LOG_API_CALL_END ("disconnect_learner");
 }
 
+/*------------------------------------------------------------------------*/
+
+void Solver::connect_importer (Importer *importer) {
+  LOG_API_CALL_BEGIN ("connect_importer");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (importer, "can not connect zero importer");
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("connecting new importer (disconnecting previous one)");
+  else
+    LOG ("connecting new importer (no previous one)");
+#endif
+#ifndef NTRACING
+  delete tracing_importer;
+  tracing_importer = 0;
+  if (trace_api_file)
+    importer = tracing_importer =
+        new TracingImporter (importer, trace_api_file);
+#endif
+  external->importer = importer;
+  LOG_API_CALL_END ("connect_importer");
+}
+
+void Solver::disconnect_importer () {
+  LOG_API_CALL_BEGIN ("disconnect_importer");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("disconnecting previous importer");
+  else
+    LOG ("ignoring to disconnect importer (no previous one)");
+#endif
+#ifndef NTRACING
+  delete tracing_importer;
+  tracing_importer = 0;
+#endif
+  external->importer = 0;
+  LOG_API_CALL_END ("disconnect_importer");
+}
+
 /*===== IPASIR END =======================================================*/
 
 /*===== IPASIR-UP BEGIN ==================================================*/
@@ -1532,7 +1597,10 @@ struct WitnessCopier : public WitnessIterator {
 public:
   WitnessCopier (External *d) : dst (d) {}
   bool witness (const vector<int> &c, const vector<int> &w) {
-    dst->push_external_clause_and_witness_on_extension_stack (c, w);
+    // The traversal does not provide clause identifiers, so we use fresh
+    // ones (which are only needed to parse the extension stack).
+    const uint64_t id = ++dst->internal->clause_id;
+    dst->push_external_clause_and_witness_on_extension_stack (c, w, id);
     return true;
   }
 };
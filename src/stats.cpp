@@ -51,6 +51,8 @@ void Stats::print (Internal *internal) {
   propagations += stats.propagations.vivify;
   propagations += stats.propagations.walk;
 
+  int64_t ticks = stats.all_ticks ();
+
   int64_t vivified = stats.vivifysubs + stats.vivifystrs;
 
   size_t extendbytes = internal->external->extension.size ();
@@ -73,6 +75,18 @@ void Stats::print (Internal *internal) {
     PRT ("  pureclauses:   %15" PRId64 "   %10.2f    per pure literal",
          stats.blockpured, relative (stats.blockpured, stats.all.pure));
   }
+  if (all || stats.bva.vars) {
+    PRT ("bva:             %15" PRId64 "   %10.2f %%  of all variables",
+         stats.bva.vars, percent (stats.bva.vars, stats.vars));
+    PRT ("  bvaphases:     %15" PRId64 "   %10.2f    interval",
+         stats.bva.count, relative (stats.conflicts, stats.bva.count));
+    PRT ("  bvaremoved:    %15" PRId64 "   %10.2f    per variable",
+         stats.bva.removed, relative (stats.bva.removed, stats.bva.vars));
+    PRT ("  bvaadded:      %15" PRId64 "   %10.2f    per variable",
+         stats.bva.added, relative (stats.bva.added, stats.bva.vars));
+    PRT ("  bvarenamed:    %15" PRId64 "   %10.2f %%  of variables",
+         stats.bva.renamed, percent (stats.bva.renamed, stats.bva.vars));
+  }
   if (all || stats.chrono)
     PRT ("chronological:   %15" PRId64 "   %10.2f %%  of conflicts",
          stats.chrono, percent (stats.chrono, stats.conflicts));
@@ -87,6 +101,9 @@ void Stats::print (Internal *internal) {
          stats.conflicts, relative (stats.conflicts, t));
     PRT ("  backtracked:   %15" PRId64 "   %10.2f %%  of conflicts",
          stats.backtracks, percent (stats.backtracks, stats.conflicts));
+    PRT ("  conflevels:    %15" PRId64 "   %10.2f %%  per propagation",
+         stats.conflictlevels,
+         percent (stats.conflictlevels, stats.propagations.search));
   }
   if (all || stats.conditioned) {
     PRT ("conditioned:     %15" PRId64
@@ -160,6 +177,8 @@ void Stats::print (Internal *internal) {
          stats.elimxors, percent (stats.elimxors, stats.elimgates));
     PRT ("  elimsubst:     %15" PRId64 "   %10.2f %%  substituted",
          stats.elimsubst, percent (stats.elimsubst, stats.all.eliminated));
+    PRT ("  elimpar:       %15" PRId64 "   %10.2f %%  checked in parallel",
+         stats.elimpar, percent (stats.elimpar, stats.all.eliminated));
     PRT ("  elimres:       %15" PRId64 "   %10.2f    per eliminated",
          stats.elimres, relative (stats.elimres, stats.all.eliminated));
     PRT ("  elimrestried:  %15" PRId64 "   %10.2f %%  per resolution",
@@ -214,6 +233,16 @@ void Stats::print (Internal *internal) {
          relative (stats.probingrounds, stats.probingphases));
     PRT ("  probed:        %15" PRId64 "   %10.2f    per failed",
          stats.probed, relative (stats.probed, stats.failed));
+    PRT ("  bitprobed:     %15" PRId64 "   %10.2f    per round",
+         stats.bitprobed,
+         relative (stats.bitprobed, stats.probingrounds));
+    PRT ("  bitfailed:     %15" PRId64 "   %10.2f %%  per bitprobed",
+         stats.bitfailed, percent (stats.bitfailed, stats.bitprobed));
+    PRT ("  bitlifted:     %15" PRId64 "   %10.2f %%  per bitprobed",
+         stats.bitlifted, percent (stats.bitlifted, stats.bitprobed));
+    PRT ("  bitequivalent: %15" PRId64 "   %10.2f %%  per bitprobed",
+         stats.bitequivalent,
+         percent (stats.bitequivalent, stats.bitprobed));
     PRT ("  hbrs:          %15" PRId64 "   %10.2f    per probed",
          stats.hbrs, relative (stats.hbrs, stats.probed));
     PRT ("  hbrsizes:      %15" PRId64 "   %10.2f    per hbr",
@@ -236,6 +265,39 @@ void Stats::print (Internal *internal) {
     PRT ("  flushings:     %15" PRId64 "   %10.2f    interval",
          stats.flush.count, relative (stats.conflicts, stats.flush.count));
   }
+  if (all || stats.gauss.xors) {
+    PRT ("gauss:           %15" PRId64 "   %10.2f    interval",
+         stats.gauss.extractions,
+         relative (stats.conflicts, stats.gauss.extractions));
+    PRT ("  xors:          %15" PRId64 "   %10.2f    per extraction",
+         stats.gauss.xors,
+         relative (stats.gauss.xors, stats.gauss.extractions));
+    PRT ("  matrices:      %15" PRId64 "   %10.2f    per extraction",
+         stats.gauss.matrices,
+         relative (stats.gauss.matrices, stats.gauss.extractions));
+    PRT ("  rows:          %15" PRId64 "   %10.2f    per matrix",
+         stats.gauss.rows,
+         relative (stats.gauss.rows, stats.gauss.matrices));
+    PRT ("  gaussunits:    %15" PRId64 "   %10.2f %%  of all variables",
+         stats.gauss.units, percent (stats.gauss.units, stats.vars));
+    PRT ("  gaussprops:    %15" PRId64 "   %10.2f %%  of propagations",
+         stats.gauss.propagations,
+         percent (stats.gauss.propagations, propagations));
+    PRT ("  gaussconfs:    %15" PRId64 "   %10.2f %%  of conflicts",
+         stats.gauss.conflicts,
+         percent (stats.gauss.conflicts, stats.conflicts));
+  }
+  if (all || stats.imported.clauses || stats.imported.ignored) {
+    PRT ("imported:        %15" PRId64 "   %10.2f %%  per conflict",
+         stats.imported.clauses,
+         percent (stats.imported.clauses, stats.conflicts));
+    PRT ("  importedunits: %15" PRId64 "   %10.2f %%  of imported",
+         stats.imported.units,
+         percent (stats.imported.units, stats.imported.clauses));
+    PRT ("  ignored:       %15" PRId64 "   %10.2f %%  of imported",
+         stats.imported.ignored,
+         percent (stats.imported.ignored, stats.imported.clauses));
+  }
   if (all || stats.instantiated) {
     PRT ("instantiated:    %15" PRId64 "   %10.2f %%  of tried",
          stats.instantiated, percent (stats.instantiated, stats.instried));
@@ -317,6 +379,13 @@ void Stats::print (Internal *internal) {
 
   PRT ("propagations:    %15" PRId64 "   %10.2f M  per second",
        propagations, relative (propagations / 1e6, t));
+#ifndef QUIET
+  if (internal->profiles.propagate.value > 0)
+    PRT ("  proptime:      %15.2f   %10.2f ns per propagation",
+         internal->profiles.propagate.value,
+         relative (1e9 * internal->profiles.propagate.value,
+                   propagations - stats.propagations.walk));
+#endif
   PRT ("  coverprops:    %15" PRId64 "   %10.2f %%  of propagations",
        stats.propagations.cover,
        percent (stats.propagations.cover, propagations));
@@ -352,6 +421,8 @@ void Stats::print (Internal *internal) {
          stats.reductions, relative (stats.conflicts, stats.reductions));
     PRT ("  collections:   %15" PRId64 "   %10.2f    interval",
          stats.collections, relative (stats.conflicts, stats.collections));
+    PRT ("  selective:     %15" PRId64 "   %10.2f    interval",
+         stats.selective, relative (stats.conflicts, stats.selective));
   }
   if (all || stats.rephased.total) {
     PRT ("rephased:        %15" PRId64 "   %10.2f    interval",
@@ -440,6 +511,9 @@ void Stats::print (Internal *internal) {
          stats.subchecks, relative (stats.subchecks, stats.subtried));
     PRT ("  subchecks2:    %15" PRId64 "   %10.2f %%  per subcheck",
          stats.subchecks2, percent (stats.subchecks2, stats.subchecks));
+    PRT ("  subsigrej:     %15" PRId64 "   %10.2f %%  of all checks",
+         stats.subsigrej,
+         percent (stats.subsigrej, stats.subsigrej + stats.subchecks));
     PRT ("  elimotfsub:    %15" PRId64 "   %10.2f %%  of subsumed",
          stats.elimotfsub, percent (stats.elimotfsub, stats.subsumed));
     PRT ("  elimbwsub:     %15" PRId64 "   %10.2f %%  of subsumed",
@@ -469,6 +543,38 @@ void Stats::print (Internal *internal) {
     PRT ("  htr2:          %15" PRId64 "   %10.2f %%  binary hyper ternres",
          stats.htrs2, percent (stats.htrs2, stats.htrs));
   }
+  if (all || ticks) {
+    PRT ("ticks:           %15" PRId64 "   %10.2f    per propagation",
+         ticks, relative (ticks, propagations));
+    PRT ("  bvaticks:      %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.bva, percent (stats.ticks.bva, ticks));
+    PRT ("  elimticks:     %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.elim, percent (stats.ticks.elim, ticks));
+    PRT ("  gaussticks:    %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.gauss, percent (stats.ticks.gauss, ticks));
+    PRT ("  probeticks:    %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.probe, percent (stats.ticks.probe, ticks));
+    PRT ("  searchticks:   %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.search, percent (stats.ticks.search, ticks));
+    PRT ("  vivifyticks:   %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.vivify, percent (stats.ticks.vivify, ticks));
+    PRT ("  walkticks:     %15" PRId64 "   %10.2f %%  of ticks",
+         stats.ticks.walk, percent (stats.ticks.walk, ticks));
+  }
+  if (all || stats.trailsave.saves) {
+    PRT ("trail saves:     %15" PRId64 "   %10.2f    interval",
+         stats.trailsave.saves,
+         relative (stats.conflicts, stats.trailsave.saves));
+    PRT ("  saved:         %15" PRId64 "   %10.2f    per save",
+         stats.trailsave.saved,
+         relative (stats.trailsave.saved, stats.trailsave.saves));
+    PRT ("  reused:        %15" PRId64 "   %10.2f %%  of saved",
+         stats.trailsave.reused,
+         percent (stats.trailsave.reused, stats.trailsave.saved));
+    PRT ("  conflicts:     %15" PRId64 "   %10.2f %%  of conflicts",
+         stats.trailsave.conflicts,
+         percent (stats.trailsave.conflicts, stats.conflicts));
+  }
   if (all || stats.ilbtriggers) {
     PRT ("trail reuses:    %15" PRId64 "   %10.2f %%  of incremental calls",
          stats.ilbsuccess, percent (stats.ilbsuccess, stats.ilbtriggers));
@@ -540,6 +646,17 @@ void Stats::print (Internal *internal) {
     PRT ("  broken:        %15" PRId64 "   %10.2f    per flip",
          stats.walk.broken, relative (stats.walk.broken, stats.walk.flips));
   }
+  if (all || stats.walkers.started) {
+    PRT ("walkers:         %15" PRId64 "   %10.2f    interval",
+         stats.walkers.started,
+         relative (stats.conflicts, stats.walkers.started));
+    PRT ("  adopted:       %15" PRId64 "   %10.2f %%  walkers",
+         stats.walkers.adopted,
+         percent (stats.walkers.adopted, stats.walkers.started));
+    PRT ("  bgflips:       %15" PRId64 "   %10.2f    per walkers",
+         stats.walkers.flips,
+         relative (stats.walkers.flips, stats.walkers.started));
+  }
   if (all || stats.weakened) {
     PRT ("weakened:        %15" PRId64 "   %10.2f    average size",
          stats.weakened, relative (stats.weakenedlen, stats.weakened));
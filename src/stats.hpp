@@ -28,6 +28,21 @@ struct Stats {
     int64_t dirty;       // propagated on highest level (with multitrail)
   } propagations;
 
+  struct {
+    int64_t bva;    // ticks in bounded variable addition
+    int64_t elim;   // ticks in resolution during variable elimination
+    int64_t gauss;  // ticks in Gauss-Jordan extraction and propagation
+    int64_t probe;  // ticks in probing propagation
+    int64_t search; // ticks in search propagation
+    int64_t vivify; // ticks in vivification propagation
+    int64_t walk;   // ticks in local search
+  } ticks;
+
+  int64_t all_ticks () const {
+    return ticks.bva + ticks.elim + ticks.gauss + ticks.probe +
+           ticks.search + ticks.vivify + ticks.walk;
+  }
+
   struct {
     int64_t ext_cb;     // number of times any external callback was called
     int64_t eprop_call; // number of times external_propagate was called
@@ -75,6 +90,14 @@ struct Stats {
     double process, real;
   } time;
 
+  struct {
+    int64_t count;   // number of bounded variable addition phases
+    int64_t added;   // added clauses
+    int64_t removed; // removed clauses
+    int64_t vars;    // introduced variables
+    int64_t renamed; // introduced variables renamed for the user
+  } bva;
+
   struct {
     int64_t count;      // number of covered clause elimination rounds
     int64_t asymmetric; // number of asymmetric tautologies in CCE
@@ -110,12 +133,28 @@ struct Stats {
     int64_t minimum;
   } walk;
 
+  struct {
+    int64_t started; // background local search snapshots
+    int64_t adopted; // phases adopted from background walkers
+    int64_t flips;   // flips of background walkers
+  } walkers;
+
   struct {
     int64_t count;   // flushings of learned clauses counter
     int64_t learned; // flushed learned clauses
     int64_t hyper;   // flushed hyper binary/ternary clauses
   } flush;
 
+  struct {
+    int64_t extractions;  // number of XOR extractions
+    int64_t xors;         // extracted XOR constraints
+    int64_t matrices;     // matrices after elimination
+    int64_t rows;         // rows in matrices after elimination
+    int64_t units;        // units derived by elimination and propagation
+    int64_t propagations; // literals propagated by rows
+    int64_t conflicts;    // conflicts found by rows
+  } gauss;
+
   int64_t compacts;      // number of compactifications
   int64_t shuffled;      // shuffled queues and scores
   int64_t restarts;      // actual number of happened restarts
@@ -131,6 +170,15 @@ struct Stats {
   int64_t chrono;        // chronological backtracks
   int64_t backtracks;    // number of backtracks
   int64_t elevated; // number of elevated literals (updated in backtrack)
+
+  struct {
+    int64_t saves;     // number of saved trails at back-jumps
+    int64_t saved;     // number of saved literals
+    int64_t reused;    // replayed implied literals
+    int64_t conflicts; // conflicts found while replaying
+  } trailsave;
+
+  int64_t conflictlevels; // examined pending multitrail conflicts
   int64_t improvedglue;   // improved glue during bumping
   int64_t promoted1;      // promoted clauses to tier one
   int64_t promoted2;      // promoted clauses to tier two
@@ -141,6 +189,7 @@ struct Stats {
   int64_t reduced;        // number of reduced clauses
   int64_t collected;      // number of collected bytes
   int64_t collections;    // number of garbage collections
+  int64_t selective;      // number of selective collections
   int64_t hbrs;           // hyper binary resolvents
   int64_t hbrsizes;       // sum of hyper resolved base clauses
   int64_t hbreds;         // redundant hyper binary resolvents
@@ -157,8 +206,9 @@ struct Stats {
   int64_t subirr;    // number of subsumed irredundant clauses
   int64_t subred;    // number of subsumed redundant clauses
   int64_t subtried;  // number of tried subsumptions
-  int64_t subchecks; // number of pair-wise subsumption checks
+  int64_t subchecks; // number of full pair-wise subsumption checks
   int64_t subchecks2;    // same but restricted to binary clauses
+  int64_t subsigrej;     // subsumption checks rejected by signatures
   int64_t elimotfsub;    // number of on-the-fly subsumed during elimination
   int64_t subsumerounds; // number of subsumption rounds
   int64_t subsumephases; // number of scheduled subsumption phases
@@ -171,6 +221,7 @@ struct Stats {
   int64_t elimcompleted;  // number complete elimination procedures
   int64_t elimtried;      // number of variable elimination attempts
   int64_t elimsubst;      // number of eliminations through substitutions
+  int64_t elimpar;        // number of eliminations checked in parallel
   int64_t elimgates;      // number of gates found during elimination
   int64_t elimequivs;     // number of equivalences found during elimination
   int64_t elimands;       // number of AND gates found during elimination
@@ -203,6 +254,11 @@ struct Stats {
     int64_t literals;
     int64_t clauses;
   } learned;
+  struct {
+    int64_t clauses; // imported clauses (including units)
+    int64_t units;   // imported unit clauses
+    int64_t ignored; // ignored (satisfied or inactive variables)
+  } imported;
   int64_t minimized;    // minimized literals
   int64_t shrunken;     // shrunken literals
   int64_t minishrunken; // shrunken during minimization literals
@@ -222,6 +278,10 @@ struct Stats {
   int64_t failed;        // number of failed literals
   int64_t hyperunary;    // hyper unary resolved unit clauses
   int64_t probefailed;   // failed literals from probing
+  int64_t bitprobed;     // lanes in bit-parallel probing
+  int64_t bitfailed;     // bit-parallel failed literal candidates
+  int64_t bitlifted;     // bit-parallel lifted unit candidates
+  int64_t bitequivalent; // bit-parallel equivalence candidates
   int64_t transredunits; // units derived in transitive reduction
   int64_t blockings;     // number of blocked clause eliminations
   int64_t blocked;       // number of actually blocked clauses
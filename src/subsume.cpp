@@ -142,6 +142,23 @@ inline int Internal::subsume_check (Clause *subsuming, Clause *subsumed) {
 
 /*------------------------------------------------------------------------*/
 
+// A clause can only subsume or strengthen the candidate clause if all its
+// variables occur in the candidate.  Thus we keep for each connected clause
+// a 64-bit signature (Bloom filter) of its variables next to it in 'sigs',
+// parallel to the occurrence lists, and compare it with the signature of
+// the candidate before calling 'subsume_check'.  Most non-subsuming pairs
+// are rejected this way without accessing the connected clause at all.
+// Using variables instead of literals keeps strengthening possible.
+
+inline uint64_t subsume_signature (Clause *c) {
+  uint64_t res = 0;
+  for (const auto &lit : *c)
+    res |= (uint64_t) 1 << (abs (lit) & 63);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Candidate clause 'subsumed' is subsumed by 'subsuming'.
 
 inline void Internal::subsume_clause (Clause *subsuming, Clause *subsumed) {
@@ -202,13 +219,15 @@ void Internal::strengthen_clause (Clause *c, int lit) {
 // can not be subsumed nor strengthened and zero is returned.
 
 inline int Internal::try_to_subsume_clause (Clause *c,
-                                            vector<Clause *> &shrunken) {
+                                            vector<Clause *> &shrunken,
+                                            vector<Sigs> &sigs) {
 
   stats.subtried++;
   assert (!level);
   LOG (c, "trying to subsume");
 
   mark (c); // signed!
+  const uint64_t signature = subsume_signature (c);
 
   Clause dummy; // Communicate binary subsuming clause.
 
@@ -277,7 +296,14 @@ inline int Internal::try_to_subsume_clause (Clause *c,
       // code after the loop is used.
       //
       const Occs &os = occs (sign * lit);
-      for (const auto &e : os) {
+      const Sigs &ss = sigs[vlit (sign * lit)];
+      assert (os.size () == ss.size ());
+      for (size_t i = 0; i < os.size (); i++) {
+        if (ss[i] & ~signature) {
+          stats.subsigrej++;
+          continue;
+        }
+        Clause *e = os[i];
         assert (!e->garbage); // sanity check
         if (e->garbage)
           continue; // defensive: not needed
@@ -295,6 +321,16 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
   unmark (c);
 
+  return subsume_or_strengthen (c, d, flipped, shrunken);
+}
+
+// Apply the result of the search for a subsuming or strengthening clause
+// 'd' of the candidate clause 'c' with the same return value contract as
+// 'try_to_subsume_clause'.
+
+inline int Internal::subsume_or_strengthen (Clause *c, Clause *d,
+                                            int flipped,
+                                            vector<Clause *> &shrunken) {
   if (flipped == INT_MIN) {
     LOG (d, "subsuming");
     subsume_clause (d, c);
@@ -356,6 +392,319 @@ struct subsume_less_noccs {
   }
 };
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+/*------------------------------------------------------------------------*/
+
+// With 'opts.subsumethreads' the scheduled clauses are split into batches.
+// Before a batch is processed, the candidates of the batch are checked
+// concurrently against the clauses connected by previous batches, which
+// are frozen while the threads run.  The checks are read-only, with
+// thread local marks, and each thread records the first subsuming or
+// strengthening clause it finds per candidate.  The main thread then goes
+// over the batch in the original order.  It only has to check the clauses
+// connected by earlier candidates of the same batch and combines them with
+// the result of the threads in the order in which the sequential algorithm
+// traverses occurrence lists.  Thus the same clauses are subsumed and
+// strengthened (with the same antecedents) independent of the number of
+// threads as in the sequential version.  Just the move-to-front of the
+// literal on which 'subsume_check' failed is skipped in threads.
+
+// For 'k' the position of 'lit' in the candidate, the occurrence lists of
+// 'sign * lit' are traversed in the order binary clauses then larger
+// clauses, each first the frozen then the new part. Hits are identified
+// by their position '4 * (2 * k + (sign > 0)) + part' in this order.
+
+struct Subsumers {
+
+  static const size_t none = ~(size_t) 0;
+
+  struct Result {
+    size_t pos;        // position of the first hit or 'none'
+    int flipped;       // as returned by 'subsume_check'
+    Clause *clause;    // subsuming clause or zero if binary
+    int lits[2];       // subsuming binary clause
+    uint64_t id;       // and its identifier
+    unsigned thread;   // which recorded the check counts
+    size_t begin, end; // of these counts
+  };
+
+  struct Counts {
+    size_t key; // '2 * k + (sign > 0)' (see above)
+    int64_t checks, checks2, rejected;
+  };
+
+  Internal *internal;
+  const vector<Sigs> &sigs;
+  vector<Clause *> candidates; // of the current batch
+  vector<Result> results;
+  vector<vector<Counts>> counts;        // per thread
+  vector<vector<signed char>> marks;    // per thread
+  vector<size_t> frozen_bins, frozen_occs; // sizes at start of batch
+  size_t begin, end;                    // current batch in schedule
+  std::atomic<size_t> next;
+
+  Subsumers (Internal *, const vector<Sigs> &);
+  void start (const vector<ClauseSize> &schedule, size_t);
+  void check (unsigned thread, size_t);
+  void run (unsigned thread);
+};
+
+Subsumers::Subsumers (Internal *i, const vector<Sigs> &s)
+    : internal (i), sigs (s), counts (i->opts.subsumethreads),
+      marks (i->opts.subsumethreads,
+             vector<signed char> (i->max_var + 1, 0)),
+      frozen_bins (2 * i->vsize), frozen_occs (2 * i->vsize), begin (0),
+      end (0), next (0) {}
+
+// Read-only version of the search in 'try_to_subsume_clause' restricted to
+// the frozen clauses with literals of the candidate marked in 'marks'.
+
+void Subsumers::check (unsigned thread, size_t i) {
+  Clause *c = candidates[i];
+  Result &res = results[i];
+  vector<Counts> &cnts = counts[thread];
+  vector<signed char> &mark = marks[thread];
+  res.pos = none, res.flipped = 0, res.clause = 0;
+  res.thread = thread, res.begin = res.end = cnts.size ();
+  if (!c)
+    return;
+  const auto marked = [&mark] (int lit) {
+    const signed char tmp = mark[abs (lit)];
+    return lit < 0 ? -tmp : tmp;
+  };
+  for (const auto &lit : *c)
+    mark[abs (lit)] = lit < 0 ? -1 : 1;
+  const uint64_t signature = subsume_signature (c);
+  const bool strengthen = internal->opts.subsumestr;
+  for (size_t k = 0; res.pos == none && k < (size_t) c->size; k++) {
+    const int lit = c->literals[k];
+    if (!internal->flags (lit).subsume)
+      continue;
+    for (int sign = -1; res.pos == none && sign <= 1; sign += 2) {
+      const size_t key = 2 * k + (sign > 0);
+      for (const auto &bin : internal->bins (sign * lit)) {
+        const int other = bin.lit;
+        const int tmp = marked (other);
+        if (!tmp || (tmp < 0 && sign < 0))
+          continue;
+        if (tmp < 0) {
+          res.lits[0] = lit;
+          res.flipped = other;
+        } else {
+          res.lits[0] = sign * lit;
+          res.flipped = (sign < 0) ? -lit : INT_MIN;
+        }
+        res.lits[1] = other;
+        res.id = bin.id;
+        res.pos = 4 * key;
+        break;
+      }
+      if (res.pos != none)
+        break;
+      const unsigned idx = internal->vlit (sign * lit);
+      const Occs &os = internal->otab[idx];
+      const Sigs &ss = sigs[idx];
+      Counts cnt = {key, 0, 0, 0};
+      for (size_t j = 0; j < os.size (); j++) {
+        if (ss[j] & ~signature) {
+          cnt.rejected++;
+          continue;
+        }
+        Clause *e = os[j];
+        cnt.checks++;
+        if (e->size == 2)
+          cnt.checks2++;
+        int flipped = 0;
+        bool failed = false;
+        for (const auto &other : *e) {
+          const int tmp = marked (other);
+          if (!tmp || (tmp < 0 && flipped)) {
+            failed = true;
+            break;
+          }
+          if (tmp < 0)
+            flipped = other;
+        }
+        if (failed || (flipped && !strengthen))
+          continue;
+        res.flipped = flipped ? flipped : INT_MIN;
+        res.clause = e;
+        res.pos = 4 * key + 2;
+        break;
+      }
+      if (cnt.checks || cnt.rejected)
+        cnts.push_back (cnt);
+    }
+  }
+  for (const auto &lit : *c)
+    mark[abs (lit)] = 0;
+  res.end = cnts.size ();
+}
+
+void Subsumers::run (unsigned thread) {
+  const size_t size = candidates.size ();
+  for (;;) {
+    const size_t i = next.fetch_add (16, std::memory_order_relaxed);
+    if (i >= size)
+      break;
+    const size_t j = min (size, i + 16);
+    for (size_t k = i; k < j; k++)
+      check (thread, k);
+  }
+}
+
+// Check the candidates of the batch starting at 'first' in parallel.
+
+void Subsumers::start (const vector<ClauseSize> &schedule, size_t first) {
+  const unsigned threads = counts.size ();
+  begin = first;
+  end = min (schedule.size (), first + 1024 * (size_t) threads);
+  candidates.clear ();
+  for (auto &cnts : counts)
+    cnts.clear ();
+  for (size_t i = begin; i < end; i++) {
+    Clause *c = schedule[i].clause;
+    if (c->size > 2 && c->subsume) {
+      for (const auto &lit : *c)
+        for (int sign = -1; sign <= 1; sign += 2) {
+          const unsigned idx = internal->vlit (sign * lit);
+          frozen_bins[idx] = internal->big[idx].size ();
+          frozen_occs[idx] = internal->otab[idx].size ();
+        }
+    } else
+      c = 0;
+    candidates.push_back (c);
+  }
+  results.resize (candidates.size ());
+  next = 0;
+  vector<std::thread> running;
+  for (unsigned i = 0; i < threads; i++)
+    running.push_back (std::thread (&Subsumers::run, this, i));
+  for (auto &thread : running)
+    thread.join ();
+}
+
+// Merge the result of the threads for the candidate at position 'i' of the
+// schedule with checks against clauses connected in the current batch.
+
+int Internal::try_to_subsume_clause_in_parallel (
+    Subsumers &subsumers, size_t i, vector<Clause *> &shrunken,
+    vector<Sigs> &sigs) {
+
+  const Subsumers::Result &res = subsumers.results[i - subsumers.begin];
+  Clause *c = subsumers.candidates[i - subsumers.begin];
+  assert (c);
+
+  stats.subtried++;
+  assert (!level);
+  LOG (c, "trying to subsume");
+
+  mark (c);
+  const uint64_t signature = subsume_signature (c);
+
+  Clause dummy;
+  Clause *d = 0;
+  int flipped = 0;
+  size_t pos = Subsumers::none;
+
+  for (size_t k = 0; !d && k < (size_t) c->size; k++) {
+    const int lit = c->literals[k];
+    if (!flags (lit).subsume)
+      continue;
+    for (int sign = -1; !d && sign <= 1; sign += 2) {
+      const size_t key = 2 * k + (sign > 0);
+      assert (res.pos == Subsumers::none || 4 * key <= res.pos);
+      if (res.pos == 4 * key) {
+        dummy.literals[0] = res.lits[0];
+        dummy.literals[1] = res.lits[1];
+        flipped = res.flipped;
+        dummy.moved = false;
+        dummy.redundant = false;
+        dummy.size = 2;
+        dummy.id = res.id;
+        d = &dummy;
+        pos = res.pos;
+        break;
+      }
+      const unsigned idx = vlit (sign * lit);
+      const Bins &bs = big[idx];
+      for (size_t j = subsumers.frozen_bins[idx]; j < bs.size (); j++) {
+        const int other = bs[j].lit;
+        const int tmp = marked (other);
+        if (!tmp || (tmp < 0 && sign < 0))
+          continue;
+        if (tmp < 0) {
+          dummy.literals[0] = lit;
+          flipped = other;
+        } else {
+          dummy.literals[0] = sign * lit;
+          flipped = (sign < 0) ? -lit : INT_MIN;
+        }
+        dummy.literals[1] = other;
+        dummy.moved = false;
+        dummy.redundant = false;
+        dummy.size = 2;
+        dummy.id = bs[j].id;
+        d = &dummy;
+        pos = 4 * key + 1;
+        break;
+      }
+      if (d)
+        break;
+      if (res.pos == 4 * key + 2) {
+        d = res.clause;
+        flipped = res.flipped;
+        pos = res.pos;
+        break;
+      }
+      const Occs &os = otab[idx];
+      const Sigs &ss = sigs[idx];
+      for (size_t j = subsumers.frozen_occs[idx]; j < os.size (); j++) {
+        if (ss[j] & ~signature) {
+          stats.subsigrej++;
+          continue;
+        }
+        flipped = subsume_check (os[j], c);
+        if (!flipped)
+          continue;
+        d = os[j];
+        pos = 4 * key + 3;
+        break;
+      }
+    }
+  }
+
+  // Account for the checks of the threads the sequential algorithm would
+  // have performed before finding the same subsuming clause.
+  //
+  const vector<Subsumers::Counts> &cnts = subsumers.counts[res.thread];
+  for (size_t j = res.begin; j < res.end; j++) {
+    const Subsumers::Counts &cnt = cnts[j];
+    if (pos != Subsumers::none && 4 * cnt.key + 2 > pos)
+      break;
+    stats.subchecks += cnt.checks;
+    stats.subchecks2 += cnt.checks2;
+    stats.subsigrej += cnt.rejected;
+  }
+
+  unmark (c);
+
+  return subsume_or_strengthen (c, d, flipped, shrunken);
+}
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+int Internal::try_to_subsume_clause_in_parallel (Subsumers &, size_t,
+                                                 vector<Clause *> &,
+                                                 vector<Sigs> &) {
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+#endif
 /*------------------------------------------------------------------------*/
 
 // Usually called from 'subsume' below if 'subsuming' triggered it.  Then
@@ -382,7 +731,7 @@ bool Internal::subsume_round () {
 
   int64_t check_limit;
   if (opts.subsumelimited) {
-    int64_t delta = stats.propagations.search;
+    int64_t delta = stats.ticks.search;
     delta *= 1e-3 * opts.subsumereleff;
     if (delta < opts.subsumemineff)
       delta = opts.subsumemineff;
@@ -483,21 +832,33 @@ bool Internal::subsume_round () {
   int64_t subsumed = 0, strengthened = 0, checked = 0;
 
   vector<Clause *> shrunken;
+  vector<Sigs> sigs (2 * vsize);
   init_occs ();
   init_bins ();
 
-  for (const auto &s : schedule) {
+#ifndef NTHREADS
+  Subsumers *subsumers = 0;
+  if (opts.subsumethreads)
+    subsumers = new Subsumers (this, sigs);
+#endif
+
+  for (size_t i = 0; i < schedule.size (); i++) {
 
     if (terminated_asynchronously ())
       break;
     if (stats.subchecks >= check_limit)
       break;
 
-    Clause *c = s.clause;
+    Clause *c = schedule[i].clause;
     assert (!c->garbage);
 
     checked++;
 
+#ifndef NTHREADS
+    if (subsumers && i >= subsumers->end)
+      subsumers->start (schedule, i);
+#endif
+
     // First try to subsume or strengthen this candidate clause.  For binary
     // clauses this could be done much faster by hashing and is costly due
     // to a usually large number of binary clauses.  There is further the
@@ -508,7 +869,14 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      int tmp;
+#ifndef NTHREADS
+      if (subsumers)
+        tmp = try_to_subsume_clause_in_parallel (*subsumers, i, shrunken,
+                                                 sigs);
+      else
+#endif
+        tmp = try_to_subsume_clause (c, shrunken, sigs);
       if (tmp > 0) {
         subsumed++;
         continue;
@@ -563,6 +931,7 @@ bool Internal::subsume_round () {
            minlit, minsize, minoccs);
 
       occs (minlit).push_back (c);
+      sigs[vlit (minlit)].push_back (subsume_signature (c));
 
       // This sorting should give faster failures for assumption checks
       // since the less occurring variables are put first in a clause and
@@ -611,9 +980,14 @@ bool Internal::subsume_round () {
            " remain)",
            checked, percent (checked, scheduled), remain);
 
+#ifndef NTHREADS
+  delete subsumers;
+#endif
+
   // Release occurrence lists and schedule.
   //
   erase_vector (schedule);
+  erase_vector (sigs);
   reset_noccs ();
   reset_occs ();
   reset_bins ();
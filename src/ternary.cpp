@@ -372,7 +372,7 @@ bool Internal::ternary () {
   // all rounds of producing ternary resolvents on all marked variables in
   // this call to the 'ternary' procedure.
   //
-  int64_t steps_limit = stats.propagations.search;
+  int64_t steps_limit = stats.ticks.search;
   steps_limit *= 1e-3 * opts.ternaryreleff;
   if (steps_limit < opts.ternarymineff)
     steps_limit = opts.ternarymineff;
@@ -2,6 +2,84 @@
 
 namespace CaDiCaL {
 
+/*------------------------------------------------------------------------*/
+
+// Segment management of the flat multitrail buffer (see 'trails.hpp').
+
+void Trails::push_level () {
+  if (tail >= 0) {
+    // Give back the unused reserved slots of the segment at the top.
+    Segment &t = segments[tail];
+    assert (t.start + t.capacity == top);
+    top = t.start + t.size;
+    t.capacity = t.size;
+    if (!moved.empty () && moved.back ().first == tail)
+      moved.back ().second = top;
+  }
+  if ((size_t) levels == segments.size ())
+    segments.push_back (Segment ());
+  tail = levels++;
+  Segment &s = segments[tail];
+  s.base = s.start = top;
+  s.capacity = s.size = s.propagated = 0;
+}
+
+void Trails::grow (int idx) {
+  assert (0 <= idx), assert (idx < levels);
+  Segment &s = segments[idx];
+  assert (s.size == s.capacity);
+  const unsigned delta = s.capacity < 16 ? 16 : s.capacity;
+  if (idx == tail) {
+    assert (s.start + s.capacity == top);
+    top += delta;
+    if (lits.size () < top)
+      lits.resize (top);
+    s.capacity += delta;
+    if (!moved.empty () && moved.back ().first == idx)
+      moved.back ().second = top;
+  } else {
+    const size_t start = top;
+    top += s.size + delta;
+    if (lits.size () < top)
+      lits.resize (top);
+    const auto from = lits.begin () + s.start;
+    std::copy (from, from + s.size, lits.begin () + start);
+    s.start = start;
+    s.capacity = s.size + delta;
+    moved.push_back ({idx, top});
+    tail = idx;
+  }
+  assert (s.start + s.capacity <= top);
+}
+
+void Trails::backtrack (int new_levels) {
+  assert (0 <= new_levels), assert (new_levels <= levels);
+  if (new_levels == levels)
+    return;
+  size_t new_top = segments[new_levels].base;
+  while (!moved.empty () && moved.back ().first >= new_levels)
+    moved.pop_back ();
+  if (!moved.empty () && moved.back ().second > new_top)
+    new_top = moved.back ().second;
+  levels = new_levels;
+  top = new_top;
+  tail = -1;
+  if (levels) {
+    const Segment &s = segments[levels - 1];
+    if (s.start + s.capacity == top)
+      tail = levels - 1;
+  }
+}
+
+void Trails::clear () {
+  moved.clear ();
+  levels = 0;
+  tail = -1;
+  top = 0;
+}
+
+/*------------------------------------------------------------------------*/
+
 // adds a trail to trails and the control to multitrail
 //
 void Internal::new_trail_level (int lit) {
@@ -11,45 +89,19 @@ void Internal::new_trail_level (int lit) {
     return;
   assert (multitrail_dirty == level - 1);
   multitrail_dirty++;
-  multitrail.push_back (0);
   control.back ().trail = notify_trail.size ();
-  size_t reserving = 0;
-  if (level < 50)
-    reserving = max_var / 10;
-  if (reserving > 50)
-    reserving = 50;
-  vector<int> a;
-  trails.push_back (a);
-  trails.back ().reserve (reserving);
-  assert ((trails.back ()).size () == 0);
-  assert (level == (int) trails.size ());
+  trails.push_level ();
+  assert (level == trails.size ());
 }
 
 // clears all trails above level
 //
 void Internal::clear_trails (int level) {
   assert (level >= 0);
-  trails.resize (level);
-}
-
-// returns size of trail
-// with opts.reimply returns size of trail of level l
-//
-int Internal::trail_size (int l) {
-  if (!opts.reimply || l == 0)
-    return (int) trail.size ();
-  assert (l > 0 && trails.size () >= (size_t) l);
-  return (int) trails[l - 1].size ();
-}
-
-// returns the trail that needs to be propagated
-//
-vector<int> *Internal::next_trail (int l) {
-  if (!opts.reimply || l <= 0) {
-    return &trail;
-  }
-  assert (l > 0 && trails.size () >= (size_t) l);
-  return &trails[l - 1];
+  if (level)
+    trails.backtrack (level);
+  else
+    trails.clear ();
 }
 
 // returns the point from which the trail is propagated
@@ -60,8 +112,7 @@ int Internal::next_propagated (int l) {
   if (!opts.reimply || l == 0) {
     return propagated;
   }
-  assert (l > 0 && trails.size () >= (size_t) l);
-  return multitrail[l - 1];
+  return trails.segment (l).propagated;
 }
 
 // returns the lowest level within some conflicting clause
@@ -75,6 +126,66 @@ int Internal::conflicting_level (Clause *c) {
   return l;
 }
 
+// Pending multitrail conflicts are kept in a bucket queue by conflicting
+// level ('conflict_buckets').  All literals of a pending conflict are
+// assigned, thus during propagation their levels can only change through
+// elevation, which only lowers the level of one literal.  Only conflicts in
+// the bucket of the old level of that literal might get a lower
+// conflicting level and have to be examined again.  Conflicts are only
+// removed in 'propagate_conflicts' after backtracking, which thus resets
+// the buckets.
+
+// adds the level of the pending conflict at position 'i' to the buckets
+//
+void Internal::push_conflict_level (size_t i) {
+  assert (i == conflict_levels.size ());
+  stats.conflictlevels++;
+  const int conf = conflicting_level (conflicts[i]);
+  conflict_levels.push_back (conf);
+  if ((size_t) conf >= conflict_buckets.size ())
+    conflict_buckets.resize (conf + 1);
+  conflict_buckets[conf].push_back (i);
+  if (!i || conf < conflict_levels[lowest_conflict])
+    lowest_conflict = i;
+}
+
+// moves conflicts of level 'old_level' to lower buckets if necessary after
+// a literal was elevated from that level
+//
+void Internal::update_conflict_levels (int old_level) {
+  if ((size_t) old_level >= conflict_buckets.size ())
+    return;
+  vector<unsigned> &bucket = conflict_buckets[old_level];
+  const auto end = bucket.end ();
+  auto j = bucket.begin ();
+  for (auto k = j; k != end; k++) {
+    const unsigned i = *k;
+    assert (conflict_levels[i] == old_level);
+    stats.conflictlevels++;
+    const int conf = conflicting_level (conflicts[i]);
+    assert (conf <= old_level);
+    if (conf == old_level) {
+      *j++ = i;
+      continue;
+    }
+    conflict_levels[i] = conf;
+    conflict_buckets[conf].push_back (i);
+    const int lowest = conflict_levels[lowest_conflict];
+    if (conf < lowest || (conf == lowest && i < lowest_conflict))
+      lowest_conflict = i;
+  }
+  bucket.resize (j - bucket.begin ());
+}
+
+// empties all buckets of pending conflicts
+//
+void Internal::clear_conflict_levels () {
+  for (const auto conf : conflict_levels)
+    conflict_buckets[conf].clear ();
+  conflict_levels.clear ();
+  lowest_conflict = 0;
+}
+
 // updates propagated for the current level
 //
 void Internal::set_propagated (int l, int prop) {
@@ -82,7 +193,7 @@ void Internal::set_propagated (int l, int prop) {
     propagated = prop;
     return;
   }
-  multitrail[l - 1] = prop;
+  trails.segment (l).propagated = prop;
 }
 
 } // namespace CaDiCaL
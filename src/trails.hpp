@@ -0,0 +1,95 @@
+#ifndef _trails_hpp_INCLUDED
+#define _trails_hpp_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace CaDiCaL {
+
+// With 'opts.reimply' every decision level has its own trail of assigned
+// literals, since literals can be elevated (out-of-order assigned) to lower
+// levels while higher levels still exist.  Instead of one heap allocated
+// vector per level all these per-level trails are kept as segments of one
+// flat literal buffer 'lits' with an offset index 'segments'.  Segments are
+// allocated at the top of the buffer.  The segment of the current decision
+// level is usually the one at the top ('tail') and thus simply grows in
+// place like the classic 'trail'.  If a segment which is not at the top
+// needs to grow, which only happens while elevating literals to lower
+// levels, it is moved to the top with twice its size as capacity.  The
+// 'segments' table is never shrunken and the buffer memory of backtracked
+// levels is just reused, so pushing and popping decision levels does not
+// allocate memory (after the buffer reached its maximum size).
+
+// Note that 'lits' might be reallocated while pushing literals, thus
+// pointers into the buffer obtained with 'begin' and 'end' are only valid
+// as long as no literal is pushed.  Positions within a level are stable.
+
+struct Trails {
+
+  struct Segment {
+    size_t base;         // top of buffer when this level was created
+    size_t start;        // offset of the first literal in 'lits'
+    unsigned capacity;   // number of reserved slots starting at 'start'
+    unsigned size;       // number of literals on this level
+    unsigned propagated; // next position to propagate on this level
+  };
+
+  std::vector<int> lits;         // flat buffer for all levels
+  std::vector<Segment> segments; // segment of level 'l' at 'l - 1'
+
+  // Moved segments might end above the base of higher levels.  We push
+  // their index and new end here in order to compute the top of the
+  // buffer after backtracking in constant amortized time.
+  //
+  std::vector<std::pair<int, size_t>> moved;
+
+  int levels;  // number of active levels ('level' in 'Internal')
+  int tail;    // index of segment ending at 'top' (or '-1')
+  size_t top;  // first unreserved position in 'lits'
+
+  Trails () : levels (0), tail (-1), top (0) {}
+
+  int size () const { return levels; }
+  bool empty () const { return !levels; }
+
+  Segment &segment (int l) {
+    assert (0 < l), assert (l <= levels);
+    return segments[l - 1];
+  }
+  const Segment &segment (int l) const {
+    assert (0 < l), assert (l <= levels);
+    return segments[l - 1];
+  }
+
+  int &lit (int l, size_t i) {
+    Segment &s = segment (l);
+    assert (i < s.size);
+    return lits[s.start + i];
+  }
+
+  // Iterating the literals of one level (but see the note above).
+  //
+  int *begin (int l) { return lits.data () + segment (l).start; }
+  int *end (int l) {
+    const Segment &s = segment (l);
+    return lits.data () + s.start + s.size;
+  }
+
+  void push_level ();
+  void push (int l, int lit) {
+    Segment &s = segment (l);
+    if (s.size == s.capacity)
+      grow (l - 1);
+    lits[s.start + s.size++] = lit;
+  }
+
+  void grow (int idx);
+  void backtrack (int new_levels);
+  void clear ();
+};
+
+} // namespace CaDiCaL
+
+#endif
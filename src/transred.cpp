@@ -26,8 +26,8 @@ void Internal::transred () {
   // Transitive reduction can not be run to completion for larger formulas
   // with many binary clauses.  We bound it in the same way as 'probe_core'.
   //
-  int64_t limit = stats.propagations.search;
-  limit -= last.transred.propagations;
+  int64_t limit = stats.ticks.search;
+  limit -= last.transred.ticks;
   limit *= 1e-3 * opts.transredreleff;
   if (limit < opts.transredmineff)
     limit = opts.transredmineff;
@@ -68,11 +68,6 @@ void Internal::transred () {
     i = clauses.begin ();
   }
 
-  // Move watches of binary clauses to the front. Thus we can stop iterating
-  // watches as soon a long clause is found during watch traversal.
-  //
-  sort_watches ();
-
   // This working stack plays the same role as the 'trail' during standard
   // propagation.
   //
@@ -112,7 +107,7 @@ void Internal::transred () {
     int dst = c->literals[1];
     if (val (src) || val (dst))
       continue;
-    if (watches (-src).size () < watches (dst).size ()) {
+    if (bwatches (-src).size () < bwatches (dst).size ()) {
       int tmp = dst;
       dst = -src;
       src = -tmp;
@@ -145,14 +140,12 @@ void Internal::transred () {
       assert (marked (lit) > 0);
       LOG ("transred propagating %d", lit);
       propagations++;
-      const Watches &ws = watches (-lit);
+      const Watches &ws = bwatches (-lit);
       const const_watch_iterator eow = ws.end ();
       const_watch_iterator k;
       for (k = ws.begin (); !transitive && !failed && k != eow; k++) {
         const Watch &w = *k;
-        if (!w.binary ())
-          break; // since we sorted watches above
-        Clause *d = w.clause;
+        Clause *d = watched (w);
         if (d == c)
           continue;
         if (irredundant && d->redundant)
@@ -237,7 +230,7 @@ void Internal::transred () {
     lrat_chain.clear ();
   }
 
-  last.transred.propagations = stats.propagations.search;
+  last.transred.ticks = stats.ticks.search;
   stats.propagations.transred += propagations;
   erase_vector (work);
 
@@ -60,6 +60,18 @@ inline size_t align (size_t n, size_t alignment) {
   return res;
 }
 
+// Number of cache lines (of 64 bytes) covered by 'bytes' consecutive bytes
+// respectively by the elements of a vector.  This is the unit of the
+// 'ticks' used to measure and limit the effort of search and inprocessing
+// in terms of memory accesses, which is deterministic and correlates much
+// better with running time than counting propagated literals.
+
+inline size_t cache_lines (size_t bytes) { return (bytes + 63) >> 6; }
+
+template <class T> inline size_t cache_lines (const vector<T> &v) {
+  return cache_lines (v.size () * sizeof (T));
+}
+
 /*------------------------------------------------------------------------*/
 
 inline bool parity (unsigned a) {
@@ -88,22 +88,22 @@ bool Internal::vivify_propagate () {
   assert (!unsat);
   START (propagate);
   int64_t before = propagated2 = propagated;
+  int64_t ticks = 0;
   for (;;) {
     if (propagated2 != trail.size ()) {
       const int lit = -trail[propagated2++];
       LOG ("vivify propagating %d over binary clauses", -lit);
-      Watches &ws = watches (lit);
+      Watches &ws = bwatches (lit);
+      ticks += 1 + cache_lines (ws);
       for (const auto &w : ws) {
-        if (!w.binary ())
-          continue;
         const signed char b = val (w.blit);
         if (b > 0)
           continue;
         if (b < 0)
-          conflict = w.clause; // but continue
+          conflict = watched (w); // but continue
         else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          vivify_assign (w.blit, w.clause);
+          build_chain_for_units (w.blit, watched (w), 0);
+          vivify_assign (w.blit, watched (w));
           lrat_chain.clear ();
         }
       }
@@ -111,61 +111,63 @@ bool Internal::vivify_propagate () {
       const int lit = -trail[propagated++];
       LOG ("vivify propagating %d over large clauses", -lit);
       Watches &ws = watches (lit);
+      ticks += 1 + cache_lines (ws);
       const const_watch_iterator eow = ws.end ();
       const_watch_iterator i = ws.begin ();
       watch_iterator j = ws.begin ();
       while (i != eow) {
         const Watch w = *j++ = *i++;
-        if (w.binary ())
-          continue;
         if (val (w.blit) > 0)
           continue;
-        if (w.clause->garbage) {
+        ticks++;
+        if (watched (w)->garbage) {
           j--;
           continue;
         }
-        if (w.clause == ignore)
+        if (watched (w) == ignore)
           continue;
-        literal_iterator lits = w.clause->begin ();
+        literal_iterator lits = watched (w)->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         const signed char u = val (other);
         if (u > 0)
           j[-1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = watched (w)->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + watched (w)->pos;
           literal_iterator k = middle;
           signed char v = -1;
           int r = 0;
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+          k = find_replacement (k, end);
+          if (k != end)
+            v = val (r = *k);
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
+            assert (watched (w)->pos <= size);
+            k = find_replacement (k, middle);
+            if (k != middle)
+              v = val (r = *k);
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          watched (w)->pos = k - lits;
+          assert (lits + 2 <= k), assert (k <= watched (w)->end ());
           if (v > 0)
             j[-1].blit = r;
           else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (watched (w), "unwatch %d in", r);
             lits[0] = other;
             lits[1] = r;
             *k = lit;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, watched (w));
             j--;
           } else if (!u) {
             assert (v < 0);
-            vivify_chain_for_units (other, w.clause);
-            vivify_assign (other, w.clause);
+            vivify_chain_for_units (other, watched (w));
+            vivify_assign (other, watched (w));
             lrat_chain.clear ();
           } else {
             assert (u < 0);
             assert (v < 0);
-            conflict = w.clause;
+            conflict = watched (w);
             break;
           }
         }
@@ -180,6 +182,7 @@ bool Internal::vivify_propagate () {
   }
   int64_t delta = propagated2 - before;
   stats.propagations.vivify += delta;
+  stats.ticks.vivify += ticks;
   if (conflict)
     LOG (conflict, "conflict");
   STOP (propagate);
@@ -1086,7 +1089,7 @@ inline void Internal::vivify_chain_for_units (int lit, Clause *reason) {
 // redundant mode is incorrect (due to propagating over redundant clauses).
 
 void Internal::vivify_round (bool redundant_mode,
-                             int64_t propagation_limit) {
+                             int64_t ticks_limit) {
 
   if (unsat)
     return;
@@ -1094,8 +1097,8 @@ void Internal::vivify_round (bool redundant_mode,
     return;
 
   PHASE ("vivify", stats.vivifications,
-         "starting %s vivification round propagation limit %" PRId64 "",
-         redundant_mode ? "redundant" : "irredundant", propagation_limit);
+         "starting %s vivification round ticks limit %" PRId64 "",
+         redundant_mode ? "redundant" : "irredundant", ticks_limit);
 
   // Disconnect all watches since we sort literals within clauses.
   //
@@ -1184,9 +1187,9 @@ void Internal::vivify_round (bool redundant_mode,
          "scheduled %" PRId64 " clauses to be vivified %.0f%%", scheduled,
          percent (scheduled, stats.current.irredundant));
 
-  // Limit the number of propagations during vivification as in 'probe'.
+  // Limit the number of ticks during vivification as in 'probe'.
   //
-  const int64_t limit = stats.propagations.vivify + propagation_limit;
+  const int64_t limit = stats.ticks.vivify + ticks_limit;
 
   connect_watches (!redundant_mode); // watch all relevant clauses
 
@@ -1196,7 +1199,7 @@ void Internal::vivify_round (bool redundant_mode,
   }
 
   while (!unsat && !terminated_asynchronously () &&
-         !vivifier.schedule.empty () && stats.propagations.vivify < limit) {
+         !vivifier.schedule.empty () && stats.ticks.vivify < limit) {
     Clause *c = vivifier.schedule.back (); // Next candidate.
     vivifier.schedule.pop_back ();
     vivify_clause (vivifier, c);
@@ -1276,7 +1279,7 @@ void Internal::vivify_round (bool redundant_mode,
   stats.subsumed += subsumed;
   stats.strengthened += strengthened;
 
-  last.vivify.propagations = stats.propagations.search;
+  last.vivify.ticks = stats.ticks.search;
 
   bool unsuccessful = !(subsumed + strengthened + units);
   report (redundant_mode ? 'w' : 'v', unsuccessful);
@@ -1299,8 +1302,8 @@ void Internal::vivify () {
   START_SIMPLIFIER (vivify, VIVIFY);
   stats.vivifications++;
 
-  int64_t limit = stats.propagations.search;
-  limit -= last.vivify.propagations;
+  int64_t limit = stats.ticks.search;
+  limit -= last.vivify.ticks;
   limit *= 1e-3 * opts.vivifyreleff;
   if (limit < opts.vivifymineff)
     limit = opts.vivifymineff;
@@ -1308,7 +1311,7 @@ void Internal::vivify () {
     limit = opts.vivifymaxeff;
 
   PHASE ("vivify", stats.vivifications,
-         "vivification limit of twice %" PRId64 " propagations", limit);
+         "vivification limit of twice %" PRId64 " ticks", limit);
 
   vivify_round (false, limit); // Vivify only irredundant clauses.
 
@@ -1318,7 +1321,7 @@ void Internal::vivify () {
 
   STOP_SIMPLIFIER (vivify, VIVIFY);
 
-  last.vivify.propagations = stats.propagations.search;
+  last.vivify.ticks = stats.ticks.search;
 }
 
 } // namespace CaDiCaL
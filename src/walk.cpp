@@ -6,20 +6,66 @@ namespace CaDiCaL {
 
 // Random walk local search based on 'ProbSAT' ideas.
 
+// By default we use a one-watch scheme, where the broken clauses are
+// traversed on every flip and break values are computed on demand from the
+// watch lists.  With 'opts.walkcache' full occurrence lists are used
+// instead, together with the number of true literals and the 'critical'
+// literal of every clause, which allows to maintain the break values of
+// all variables and the set of broken clauses incrementally as in 'YalSAT'.
+// The cost of a flip is then bounded by the number of occurrences of the
+// flipped variable instead of the number of broken clauses, which can be
+// huge initially on large instances.
+
 struct Walker {
 
   Internal *internal;
 
   Random random;           // local random number generator
   int64_t propagations;    // number of propagations
-  int64_t limit;           // limit on number of propagations
+  int64_t ticks;           // number of ticks (cache lines accessed)
+  int64_t limit;           // limit on number of ticks
   vector<Clause *> broken; // currently unsatisfied clauses
   double epsilon;          // smallest considered score
   vector<double> table;    // break value to score table
   vector<double> scores;   // scores of candidate literals
 
+  // Cached break-count engine ('opts.walkcache').
+  //
+  bool cached;                  // use the cached engine
+  vector<Clause *> clauses;     // considered clauses
+  vector<unsigned> offsets;     // occurrence list start per literal
+  vector<unsigned> occurrences; // clause indices of all occurrences
+  vector<unsigned> counts;      // number of true literals per clause
+  vector<int> critical;         // exclusive or of true literals
+  vector<unsigned> breaks;      // break count per variable
+  vector<unsigned> unsatisfied; // indices of broken clauses
+  vector<unsigned> positions;   // position of clause in 'unsatisfied'
+
   double score (unsigned); // compute score from break count
 
+  int64_t broken_clauses () const {
+    return cached ? unsatisfied.size () : broken.size ();
+  }
+
+  const unsigned *begin (int lit) const {
+    return occurrences.data () + offsets[internal->vlit (lit)];
+  }
+  const unsigned *end (int lit) const {
+    return occurrences.data () + offsets[internal->vlit (lit) + 1];
+  }
+
+  void make (unsigned c) {
+    const unsigned pos = positions[c];
+    const unsigned last = unsatisfied.back ();
+    unsatisfied[pos] = last;
+    positions[last] = pos;
+    unsatisfied.pop_back ();
+  }
+  void brake (unsigned c) {
+    positions[c] = unsatisfied.size ();
+    unsatisfied.push_back (c);
+  }
+
   Walker (Internal *, double size, int64_t limit);
 };
 
@@ -44,7 +90,7 @@ static const int ncbvals = sizeof cbvals / sizeof cbvals[0];
 //
 // where 'x' is the average size of clauses and 'y' the CB value.
 
-inline static double fitcbval (double size) {
+double fitcbval (double size) {
   int i = 0;
   while (i + 2 < ncbvals &&
          (cbvals[i][0] > size || cbvals[i + 1][0] < size))
@@ -62,7 +108,7 @@ inline static double fitcbval (double size) {
 
 Walker::Walker (Internal *i, double size, int64_t l)
     : internal (i), random (internal->opts.seed), // global random seed
-      propagations (0), limit (l) {
+      propagations (0), ticks (0), limit (l), cached (internal->opts.walkcache) {
   random += internal->stats.walk.count; // different seed every time
 
   // This is the magic constant in ProbSAT (also called 'CB'), which we pick
@@ -95,12 +141,13 @@ inline double Walker::score (unsigned i) {
 
 Clause *Internal::walk_pick_clause (Walker &walker) {
   require_mode (WALK);
-  assert (!walker.broken.empty ());
-  int64_t size = walker.broken.size ();
+  int64_t size = walker.broken_clauses ();
+  assert (size > 0);
   if (size > INT_MAX)
     size = INT_MAX;
   int pos = walker.random.pick_int (0, size - 1);
-  Clause *res = walker.broken[pos];
+  Clause *res = walker.cached ? walker.clauses[walker.unsatisfied[pos]]
+                              : walker.broken[pos];
   LOG (res, "picking random position %d", pos);
   return res;
 }
@@ -110,23 +157,32 @@ Clause *Internal::walk_pick_clause (Walker &walker) {
 // Compute the number of clauses which would be become unsatisfied if 'lit'
 // is flipped and set to false.  This is called the 'break-count' of 'lit'.
 
-unsigned Internal::walk_break_value (int lit) {
+unsigned Internal::walk_break_value (int lit, int64_t &ticks) {
 
   require_mode (WALK);
   assert (val (lit) > 0);
 
   unsigned res = 0; // The computed break-count of 'lit'.
 
-  for (auto &w : watches (lit)) {
+  const Watches &bs = bwatches (lit);
+  ticks += 1 + cache_lines (bs);
+
+  for (const auto &w : bs) {
     assert (w.blit != lit);
-    if (val (w.blit) > 0)
-      continue;
-    if (w.binary ()) {
+    if (val (w.blit) < 0)
       res++;
+  }
+
+  Watches &ws = watches (lit);
+  ticks += cache_lines (ws);
+
+  for (auto &w : ws) {
+    assert (w.blit != lit);
+    if (val (w.blit) > 0)
       continue;
-    }
 
-    Clause *c = w.clause;
+    ticks++;
+    Clause *c = watched (w);
     assert (lit == c->literals[0]);
 
     // Now try to find a second satisfied literal starting at 'literals[1]'
@@ -188,7 +244,7 @@ int Internal::walk_pick_lit (Walker &walker, Clause *c) {
   LOG ("picking literal by break-count");
   assert (walker.scores.empty ());
   double sum = 0;
-  int64_t propagations = 0;
+  int64_t propagations = 0, ticks = 0;
   for (const auto lit : *c) {
     assert (active (lit));
     if (var (lit).level == 1) {
@@ -196,8 +252,11 @@ int Internal::walk_pick_lit (Walker &walker, Clause *c) {
       continue;
     }
     assert (active (lit));
-    propagations++;
-    unsigned tmp = walk_break_value (-lit);
+    unsigned tmp;
+    if (walker.cached)
+      tmp = walker.breaks[abs (lit)];
+    else
+      propagations++, tmp = walk_break_value (-lit, ticks);
     double score = walker.score (tmp);
     LOG ("literal %d break-count %u score %g", lit, tmp, score);
     walker.scores.push_back (score);
@@ -207,6 +266,8 @@ int Internal::walk_pick_lit (Walker &walker, Clause *c) {
   assert (!walker.scores.empty ());
   walker.propagations += propagations;
   stats.propagations.walk += propagations;
+  walker.ticks += ticks;
+  stats.ticks.walk += ticks;
   assert (walker.scores.size () <= (size_t) c->size);
   const double lim = sum * walker.random.generate_double ();
   LOG ("score sum %g limit %g", sum, lim);
@@ -267,7 +328,8 @@ void Internal::walk_flip_lit (Walker &walker, int lit) {
     // statistics we simply increment the propagation counter after every
     // 'ratio' traversed clause.  These propagations are particularly
     // expensive if the number of broken clauses is large which usually
-    // happens initially.
+    // happens initially.  The ticks on the other hand simply count every
+    // traversed broken clause as one random memory access.
     //
     const double ratio = clause_variable_ratio ();
     const auto eou = walker.broken.end ();
@@ -329,6 +391,10 @@ void Internal::walk_flip_lit (Walker &walker, int lit) {
       stats.propagations.walk++;
     }
     LOG ("made %" PRId64 " clauses by flipping %d", made, lit);
+    const int64_t ticks = 1 + cache_lines (walker.broken) +
+                          (eou - walker.broken.begin ());
+    walker.ticks += ticks;
+    stats.ticks.walk += ticks;
     walker.broken.resize (j - walker.broken.begin ());
   }
 
@@ -337,52 +403,169 @@ void Internal::walk_flip_lit (Walker &walker, int lit) {
     walker.propagations++;     // This really corresponds now to one
     stats.propagations.walk++; // propagation (in a one-watch scheme).
 
+    int64_t ticks = 0;
+
 #ifdef LOGGING
     int64_t broken = 0;
 #endif
-    Watches &ws = watches (-lit);
+    for (int binary = 0; binary < 2; binary++) {
 
-    LOG ("trying to brake %zd watched clauses", ws.size ());
+      Watches &ws = binary ? bwatches (-lit) : watches (-lit);
+      ticks += 1 + cache_lines (ws) + ws.size ();
 
-    for (const auto &w : ws) {
-      Clause *d = w.clause;
-      LOG (d, "unwatch %d in", -lit);
-      int *literals = d->literals, replacement = 0, prev = -lit;
-      assert (literals[0] == -lit);
-      const int size = d->size;
-      for (int i = 1; i < size; i++) {
-        const int other = literals[i];
-        assert (active (other));
-        literals[i] = prev; // shift all to right
-        prev = other;
-        const signed char tmp = val (other);
-        if (tmp < 0)
-          continue;
-        replacement = other; // satisfying literal
-        break;
-      }
-      if (replacement) {
-        literals[1] = -lit;
-        literals[0] = replacement;
-        assert (-lit != replacement);
-        watch_literal (replacement, -lit, d);
-      } else {
-        for (int i = size - 1; i > 0; i--) { // undo shift
+      LOG ("trying to brake %zd watched clauses", ws.size ());
+
+      for (const auto &w : ws) {
+        Clause *d = watched (w);
+        LOG (d, "unwatch %d in", -lit);
+        int *literals = d->literals, replacement = 0, prev = -lit;
+        assert (literals[0] == -lit);
+        const int size = d->size;
+        for (int i = 1; i < size; i++) {
           const int other = literals[i];
-          literals[i] = prev;
+          assert (active (other));
+          literals[i] = prev; // shift all to right
           prev = other;
+          const signed char tmp = val (other);
+          if (tmp < 0)
+            continue;
+          replacement = other; // satisfying literal
+          break;
         }
-        assert (literals[0] == -lit);
-        LOG (d, "broken");
-        walker.broken.push_back (d);
+        if (replacement) {
+          literals[1] = -lit;
+          literals[0] = replacement;
+          assert (-lit != replacement);
+          watch_literal (replacement, -lit, d);
+        } else {
+          for (int i = size - 1; i > 0; i--) { // undo shift
+            const int other = literals[i];
+            literals[i] = prev;
+            prev = other;
+          }
+          assert (literals[0] == -lit);
+          LOG (d, "broken");
+          walker.broken.push_back (d);
 #ifdef LOGGING
-        broken++;
+          broken++;
 #endif
+        }
       }
+      ws.clear ();
     }
     LOG ("broken %" PRId64 " clauses by flipping %d", broken, lit);
-    ws.clear ();
+    walker.ticks += ticks;
+    stats.ticks.walk += ticks;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Build the occurrence lists of the clauses collected for the cached
+// engine and initialize true literal counts, critical literals, break
+// counts and the broken clauses from the initial assignment.
+
+void Internal::walk_init_cache (Walker &walker) {
+
+  require_mode (WALK);
+  assert (walker.cached);
+
+  const size_t size = 2 * (max_var + 1) + 1;
+  vector<unsigned> &offsets = walker.offsets;
+  offsets.assign (size, 0);
+  const size_t nclauses = walker.clauses.size ();
+  for (const auto c : walker.clauses)
+    for (const auto lit : *c)
+      offsets[vlit (lit) + 1]++;
+  for (size_t i = 1; i < size; i++)
+    offsets[i] += offsets[i - 1];
+  walker.occurrences.resize (offsets.back ());
+  vector<unsigned> next (offsets.begin (), offsets.end () - 1);
+  for (size_t i = 0; i < nclauses; i++)
+    for (const auto lit : *walker.clauses[i])
+      walker.occurrences[next[vlit (lit)]++] = i;
+  erase_vector (next);
+
+  walker.counts.resize (nclauses);
+  walker.critical.resize (nclauses);
+  walker.positions.resize (nclauses);
+  walker.breaks.assign (max_var + 1, 0);
+  for (size_t i = 0; i < nclauses; i++) {
+    unsigned count = 0;
+    int critical = 0;
+    for (const auto lit : *walker.clauses[i])
+      if (val (lit) > 0)
+        count++, critical ^= lit;
+    walker.counts[i] = count;
+    walker.critical[i] = critical;
+    if (!count)
+      walker.brake (i);
+    else if (count == 1)
+      walker.breaks[abs (critical)]++;
+  }
+
+  PHASE ("walk", stats.walk.count,
+         "cached %zu occurrences of %zu clauses", walker.occurrences.size (),
+         nclauses);
+}
+
+// Flipping 'lit' only needs to visit the clauses in which 'lit' or its
+// negation occur.  The critical literal of a clause with exactly one true
+// literal is that literal, which is obtained as the exclusive or of all
+// true literals.
+
+void Internal::walk_flip_cached_lit (Walker &walker, int lit) {
+
+  require_mode (WALK);
+  LOG ("flipping assign %d", lit);
+  assert (val (lit) < 0);
+
+  const int idx = abs (lit);
+  set_val (idx, sign (lit));
+  assert (val (lit) > 0);
+
+  unsigned *counts = walker.counts.data ();
+  int *critical = walker.critical.data ();
+  unsigned *breaks = walker.breaks.data ();
+
+  for (auto p = walker.begin (lit), e = walker.end (lit); p != e; p++) {
+    const unsigned c = *p;
+    const unsigned count = counts[c]++;
+    if (!count) {
+      LOG (walker.clauses[c], "made");
+      walker.make (c);
+      breaks[idx]++;
+    } else if (count == 1)
+      breaks[abs (critical[c])]--;
+    critical[c] ^= lit;
+  }
+
+  for (auto p = walker.begin (-lit), e = walker.end (-lit); p != e; p++) {
+    const unsigned c = *p;
+    const unsigned count = --counts[c];
+    critical[c] ^= -lit;
+    if (!count) {
+      LOG (walker.clauses[c], "broken");
+      walker.brake (c);
+      breaks[idx]--;
+    } else if (count == 1)
+      breaks[abs (critical[c])]++;
   }
+
+  // Unlike traversing broken clauses in 'walk_flip_lit' every visited
+  // occurrence is a random memory access, similar to visiting a watch
+  // during propagation, and is thus counted as one propagation and one
+  // tick (in addition to the cache lines of the occurrences).
+  //
+  const int64_t occurrences = (walker.end (lit) - walker.begin (lit)) +
+                              (walker.end (-lit) - walker.begin (-lit));
+  const int64_t propagations = 1 + occurrences;
+  walker.propagations += propagations;
+  stats.propagations.walk += propagations;
+  const int64_t ticks =
+      propagations + cache_lines (occurrences * sizeof (unsigned));
+  walker.ticks += ticks;
+  stats.ticks.walk += ticks;
 }
 
 /*------------------------------------------------------------------------*/
@@ -390,7 +573,7 @@ void Internal::walk_flip_lit (Walker &walker, int lit) {
 // Check whether to save the current phases as new global minimum.
 
 inline void Internal::walk_save_minimum (Walker &walker) {
-  int64_t broken = walker.broken.size ();
+  int64_t broken = walker.broken_clauses ();
   if (broken >= stats.walk.minimum)
     return;
   VERBOSE (3, "new global minimum %" PRId64 "", broken);
@@ -432,7 +615,7 @@ int Internal::walk_round (int64_t limit, bool prev) {
 #endif
 
   PHASE ("walk", stats.walk.count,
-         "random walk limit of %" PRId64 " propagations", limit);
+         "random walk limit of %" PRId64 " ticks", limit);
 
   // First compute the average clause size for picking the CB constant.
   //
@@ -560,7 +743,9 @@ int Internal::walk_round (int64_t limit, bool prev) {
         break;
       }
 
-      if (satisfied) {
+      if (walker.cached)
+        walker.clauses.push_back (c);
+      else if (satisfied) {
         watch_literal (lits[0], lits[1], c);
 #ifdef LOGGING
         watched++;
@@ -571,8 +756,10 @@ int Internal::walk_round (int64_t limit, bool prev) {
         walker.broken.push_back (c);
       }
     }
+    if (!failed && walker.cached)
+      walk_init_cache (walker);
 #ifdef LOGGING
-    if (!failed) {
+    if (!failed && !walker.cached) {
       int64_t broken = walker.broken.size ();
       int64_t total = watched + broken;
       LOG ("watching %" PRId64 " clauses %.0f%% "
@@ -588,7 +775,7 @@ int Internal::walk_round (int64_t limit, bool prev) {
 
   if (!failed) {
 
-    int64_t broken = walker.broken.size ();
+    int64_t broken = walker.broken_clauses ();
 
     PHASE ("walk", stats.walk.count,
            "starting with %" PRId64 " unsatisfied clauses "
@@ -602,8 +789,8 @@ int Internal::walk_round (int64_t limit, bool prev) {
 #ifndef QUIET
     int64_t flips = 0;
 #endif
-    while (!terminated_asynchronously () && !walker.broken.empty () &&
-           walker.propagations < walker.limit) {
+    while (!terminated_asynchronously () && broken &&
+           walker.ticks < walker.limit) {
 #ifndef QUIET
       flips++;
 #endif
@@ -611,8 +798,11 @@ int Internal::walk_round (int64_t limit, bool prev) {
       stats.walk.broken += broken;
       Clause *c = walk_pick_clause (walker);
       const int lit = walk_pick_lit (walker, c);
-      walk_flip_lit (walker, lit);
-      broken = walker.broken.size ();
+      if (walker.cached)
+        walk_flip_cached_lit (walker, lit);
+      else
+        walk_flip_lit (walker, lit);
+      broken = walker.broken_clauses ();
       LOG ("now have %" PRId64 " broken clauses in total", broken);
       if (broken >= minimum)
         continue;
@@ -682,7 +872,7 @@ int Internal::walk_round (int64_t limit, bool prev) {
 
 void Internal::walk () {
   START_INNER_WALK ();
-  int64_t limit = stats.propagations.search;
+  int64_t limit = stats.ticks.search;
   limit *= 1e-3 * opts.walkreleff;
   if (limit < opts.walkmineff)
     limit = opts.walkmineff;
@@ -0,0 +1,347 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+/*------------------------------------------------------------------------*/
+
+// Background local search threads (see 'walkers.hpp').  The walkers are
+// started at the beginning of the CDCL search loop and restarted on a
+// fresh snapshot of the formula at every walk rephase after adopting the
+// best assignment found so far as saved phases.  Since the variable
+// indices change during compacting, the walkers are restarted there too.
+
+Walkers::Slot::Slot (int max_var)
+    : stamp (0), minimum (INT64_MAX), values (max_var + 1) {}
+
+// Take the snapshot of the irredundant clauses with root level satisfied
+// clauses and falsified literals removed and the saved phases as initial
+// assignment.  This happens on the main thread and thus can access the
+// data structures of 'Internal'.
+
+Walkers::Walkers (Internal *internal)
+    : max_var (internal->max_var), stopping (false), flips (0) {
+  seed = internal->opts.seed + internal->stats.walkers.started;
+  for (const auto &c : internal->clauses) {
+    if (c->garbage || c->redundant)
+      continue;
+    const size_t size = lits.size ();
+    bool satisfied = false;
+    for (const auto lit : *c) {
+      const int tmp = internal->fixed (lit);
+      if (tmp > 0) {
+        satisfied = true;
+        break;
+      }
+      if (!tmp)
+        lits.push_back (lit);
+    }
+    if (satisfied || lits.size () == size)
+      lits.resize (size);
+    else
+      lits.push_back (0);
+  }
+  phases.resize (max_var + 1);
+  for (int idx = 1; idx <= max_var; idx++)
+    phases[idx] = internal->phases.saved[idx] < 0 ? -1 : 1;
+}
+
+Walkers::~Walkers () {
+  assert (threads.empty ());
+  for (auto slot : slots)
+    delete slot;
+}
+
+void Walkers::start (int n) {
+  assert (threads.empty ());
+  for (int i = 0; i < n; i++)
+    slots.push_back (new Slot (max_var));
+  for (int i = 0; i < n; i++)
+    threads.push_back (std::thread (&Walkers::run, this, i));
+}
+
+void Walkers::stop () {
+  stopping.store (true, std::memory_order_relaxed);
+  for (auto &thread : threads)
+    thread.join ();
+  threads.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Publish the best assignment, which is the current one with the flipped
+// variables since reaching the minimum flipped back (variables flipped an
+// even number of times are toggled back and forth).
+
+void Walkers::publish (Slot &slot, const std::vector<signed char> &values,
+                       const std::vector<int> &flipped, int64_t minimum) {
+  const uint64_t stamp = slot.stamp.load (std::memory_order_relaxed);
+  slot.stamp.store (stamp + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence (std::memory_order_release);
+  for (int idx = 1; idx <= max_var; idx++)
+    slot.values[idx].store (values[idx], std::memory_order_relaxed);
+  for (const auto idx : flipped) {
+    const signed char tmp = slot.values[idx].load (std::memory_order_relaxed);
+    slot.values[idx].store (-tmp, std::memory_order_relaxed);
+  }
+  slot.minimum.store (minimum, std::memory_order_relaxed);
+  slot.stamp.store (stamp + 2, std::memory_order_release);
+}
+
+// Copy the published assignment with the fewest broken clauses into
+// 'values' and return that minimum (or a negative number if no thread
+// published anything yet).  A slot written concurrently is simply tried
+// again.
+
+int64_t Walkers::adopt (std::vector<signed char> &values) {
+  for (;;) {
+    Slot *best = 0;
+    uint64_t stamp = 0;
+    int64_t minimum = INT64_MAX;
+    for (auto slot : slots) {
+      const uint64_t tmp = slot->stamp.load (std::memory_order_acquire);
+      if (!tmp || (tmp & 1))
+        continue;
+      const int64_t broken = slot->minimum.load (std::memory_order_relaxed);
+      if (broken >= minimum)
+        continue;
+      minimum = broken;
+      stamp = tmp;
+      best = slot;
+    }
+    if (!best)
+      return -1;
+    values.resize (max_var + 1);
+    for (int idx = 1; idx <= max_var; idx++)
+      values[idx] = best->values[idx].load (std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_acquire);
+    if (best->stamp.load (std::memory_order_relaxed) == stamp)
+      return minimum;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// The local search of one thread, which works on its own data only apart
+// from reading the shared snapshot.  The data structures are the same as
+// for the cached engine in 'walk.cpp': full occurrence lists, number of
+// true literals per clause, the exclusive or of its true literals (the
+// critical literal if there is only one) and incrementally updated break
+// counts.  To avoid copying the assignment at every new minimum, the
+// variables flipped since the last minimum are recorded instead and the
+// best assignment is only published after a sufficiently long sequence of
+// non-improving flips, at the end or if all clauses are satisfied.
+
+void Walkers::run (int id) {
+
+  Slot &slot = *slots[id];
+  Random random (seed);
+  random += id;
+
+  std::vector<signed char> values (phases);
+  std::vector<unsigned> clauses; // start of clause in 'lits'
+  for (size_t i = 0, j = 0; i < lits.size (); i++)
+    if (!lits[i])
+      clauses.push_back (j), j = i + 1;
+  const size_t nclauses = clauses.size ();
+
+  auto vlit = [] (int lit) {
+    return (lit < 0) + 2u * (unsigned) abs (lit);
+  };
+  const size_t size = 2 * (max_var + 1) + 1;
+  std::vector<unsigned> offsets (size, 0);
+  for (const auto lit : lits)
+    if (lit)
+      offsets[vlit (lit) + 1]++;
+  for (size_t i = 1; i < size; i++)
+    offsets[i] += offsets[i - 1];
+  std::vector<unsigned> occurrences (offsets.back ());
+  {
+    std::vector<unsigned> next (offsets.begin (), offsets.end () - 1);
+    for (size_t i = 0; i < nclauses; i++)
+      for (const int *p = &lits[clauses[i]]; *p; p++)
+        occurrences[next[vlit (*p)]++] = i;
+  }
+
+  std::vector<unsigned> counts (nclauses), positions (nclauses);
+  std::vector<int> critical (nclauses);
+  std::vector<unsigned> breaks (max_var + 1), unsatisfied;
+  auto value = [&values] (int lit) {
+    const signed char tmp = values[abs (lit)];
+    return lit < 0 ? -tmp : tmp;
+  };
+  for (size_t i = 0; i < nclauses; i++) {
+    unsigned count = 0;
+    int tmp = 0;
+    for (const int *p = &lits[clauses[i]]; *p; p++)
+      if (value (*p) > 0)
+        count++, tmp ^= *p;
+    counts[i] = count;
+    critical[i] = tmp;
+    if (!count)
+      positions[i] = unsatisfied.size (), unsatisfied.push_back (i);
+    else if (count == 1)
+      breaks[abs (tmp)]++;
+  }
+
+  // Every other thread uses the 'CB' value fitted to the average clause
+  // size and otherwise the default '2.0' (see 'Walker' in 'walk.cpp').
+  //
+  const double average = nclauses ? (lits.size () - nclauses) /
+                                        (double) nclauses
+                                  : 0;
+  const double cb = (id & 1) ? fitcbval (average) : 2.0;
+  const double base = 1 / cb;
+  std::vector<double> table;
+  double epsilon, next = 1;
+  for (epsilon = next; next; next = epsilon * base)
+    table.push_back (epsilon = next);
+  std::vector<double> scores;
+
+  std::vector<int> flipped;
+  const size_t delay = max_var < 1000 ? 1000 : max_var;
+  int64_t minimum = unsatisfied.size ();
+  bool dirty = true;
+  int64_t local = 0;
+
+  while (!unsatisfied.empty ()) {
+
+    if (!(++local & 255)) {
+      flips.fetch_add (256, std::memory_order_relaxed);
+      if (stopping.load (std::memory_order_relaxed))
+        break;
+    }
+
+    const int pos = random.pick_int (0, (int) unsatisfied.size () - 1);
+    const int *c = &lits[clauses[unsatisfied[pos]]];
+
+    double sum = 0;
+    for (const int *p = c; *p; p++) {
+      const unsigned b = breaks[abs (*p)];
+      const double score = b < table.size () ? table[b] : epsilon;
+      scores.push_back (score);
+      sum += score;
+    }
+    const double lim = sum * random.generate_double ();
+    const int *p = c;
+    auto j = scores.begin ();
+    sum = *j++;
+    while (sum <= lim && p[1])
+      sum += *j++, p++;
+    scores.clear ();
+    const int lit = *p;
+
+    const int idx = abs (lit);
+    values[idx] = lit < 0 ? -1 : 1;
+
+    for (unsigned k = offsets[vlit (lit)]; k != offsets[vlit (lit) + 1];
+         k++) {
+      const unsigned d = occurrences[k];
+      const unsigned count = counts[d]++;
+      if (!count) {
+        const unsigned last = unsatisfied.back ();
+        unsatisfied[positions[d]] = last;
+        positions[last] = positions[d];
+        unsatisfied.pop_back ();
+        breaks[idx]++;
+      } else if (count == 1)
+        breaks[abs (critical[d])]--;
+      critical[d] ^= lit;
+    }
+
+    for (unsigned k = offsets[vlit (-lit)]; k != offsets[vlit (-lit) + 1];
+         k++) {
+      const unsigned d = occurrences[k];
+      const unsigned count = --counts[d];
+      critical[d] ^= -lit;
+      if (!count) {
+        positions[d] = unsatisfied.size ();
+        unsatisfied.push_back (d);
+        breaks[idx]--;
+      } else if (count == 1)
+        breaks[abs (critical[d])]++;
+    }
+
+    const int64_t broken = unsatisfied.size ();
+    if (broken < minimum) {
+      minimum = broken;
+      flipped.clear ();
+      dirty = true;
+    } else if (dirty) {
+      flipped.push_back (idx);
+      if (flipped.size () >= delay) {
+        publish (slot, values, flipped, minimum);
+        flipped.clear ();
+        dirty = false;
+      }
+    }
+  }
+
+  flips.fetch_add (local & 255, std::memory_order_relaxed);
+  if (dirty)
+    publish (slot, values, flipped, minimum);
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::start_walkers () {
+  assert (!walkers);
+  assert (opts.walkthreads);
+  stats.walkers.started++;
+  walkers = new Walkers (this);
+  PHASE ("walkers", stats.walkers.started,
+         "starting %d background walkers on %zu literals",
+         (int) opts.walkthreads, walkers->lits.size ());
+  walkers->start (opts.walkthreads);
+}
+
+void Internal::stop_walkers () {
+  if (!walkers)
+    return;
+  walkers->stop ();
+  stats.walkers.flips += walkers->flips.load (std::memory_order_relaxed);
+  delete walkers;
+  walkers = 0;
+}
+
+// Adopt the best assignment found by the background walkers as saved
+// phases of active variables and then restart them on a fresh snapshot.
+// As long as they have not published anything they keep running on their
+// current snapshot, since otherwise on large instances walkers would be
+// restarted at every walk rephase before ever publishing phases.
+
+void Internal::restart_walkers () {
+  assert (walkers);
+  vector<signed char> values;
+  const int64_t minimum = walkers->adopt (values);
+  if (minimum >= 0) {
+    stats.walkers.adopted++;
+    const int size = min (max_var, walkers->max_var);
+    for (int idx = 1; idx <= size; idx++)
+      if (active (idx))
+        phases.saved[idx] = values[idx];
+    PHASE ("walkers", stats.walkers.started,
+           "adopted phases with %" PRId64 " broken clauses", minimum);
+  } else {
+    PHASE ("walkers", stats.walkers.started,
+           "background walkers did not publish phases yet");
+    return;
+  }
+  stop_walkers ();
+  start_walkers ();
+}
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+void Internal::start_walkers () {}
+void Internal::stop_walkers () {}
+void Internal::restart_walkers () {}
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
+
+} // namespace CaDiCaL
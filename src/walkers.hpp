@@ -0,0 +1,58 @@
+#ifndef _walkers_hpp_INCLUDED
+#define _walkers_hpp_INCLUDED
+
+#ifndef NTHREADS
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace CaDiCaL {
+
+struct Internal;
+
+// Background local search with 'opts.walkthreads' threads.  Each thread
+// runs a 'ProbSAT' style random walk with cached break counts (as the
+// 'walkcache' engine in 'walk.cpp') on its own copy of a snapshot of the
+// irredundant clauses.  The search never waits for these threads.  Instead
+// every thread publishes the best assignment it found so far (the one with
+// the minimum number of broken clauses) into its own slot, which is read
+// without locking (sequence lock) when the next walk rephase is scheduled.
+
+struct Walkers {
+
+  struct Slot {
+    std::atomic<uint64_t> stamp;  // odd while being written
+    std::atomic<int64_t> minimum; // broken clauses of published values
+    std::vector<std::atomic<signed char>> values;
+    Slot (int max_var);
+  };
+
+  int max_var;                     // variables in the snapshot
+  uint64_t seed;                   // base of the thread random seeds
+  std::vector<int> lits;           // zero terminated snapshot clauses
+  std::vector<signed char> phases; // initial assignment
+
+  std::atomic<bool> stopping;       // asynchronous termination
+  std::atomic<int64_t> flips;       // flips of all threads
+  std::vector<Slot *> slots;        // one per thread
+  std::vector<std::thread> threads; // running walkers
+
+  Walkers (Internal *);
+  ~Walkers ();
+
+  void start (int threads);
+  void stop ();
+  void run (int id);
+  void publish (Slot &, const std::vector<signed char> &values,
+                const std::vector<int> &flipped, int64_t minimum);
+  int64_t adopt (std::vector<signed char> &values);
+};
+
+double fitcbval (double size); // in 'walk.cpp'
+
+} // namespace CaDiCaL
+
+#endif
+
+#endif
@@ -4,19 +4,23 @@ namespace CaDiCaL {
 
 void Internal::init_watches () {
   assert (wtab.empty ());
+  assert (bwtab.empty ());
   if (wtab.size () < 2 * vsize)
     wtab.resize (2 * vsize, Watches ());
+  if (bwtab.size () < 2 * vsize)
+    bwtab.resize (2 * vsize, Watches ());
   LOG ("initialized watcher tables");
 }
 
 void Internal::clear_watches () {
   for (auto lit : lits)
-    watches (lit).clear ();
+    watches (lit).clear (), bwatches (lit).clear ();
 }
 
 void Internal::reset_watches () {
   assert (!wtab.empty ());
   erase_vector (wtab);
+  erase_vector (bwtab);
   LOG ("reset watcher tables");
 }
 
@@ -76,33 +80,6 @@ void Internal::connect_watches (bool irredundant_only) {
   STOP (connect);
 }
 
-void Internal::sort_watches () {
-  assert (watching ());
-  LOG ("sorting watches");
-  Watches saved;
-  for (auto lit : lits) {
-    Watches &ws = watches (lit);
-
-    const const_watch_iterator end = ws.end ();
-    watch_iterator j = ws.begin ();
-    const_watch_iterator i;
-
-    assert (saved.empty ());
-
-    for (i = j; i != end; i++) {
-      const Watch w = *i;
-      if (w.binary ())
-        *j++ = w;
-      else
-        saved.push_back (w);
-    }
-
-    std::copy (saved.cbegin (), saved.cend (), j);
-
-    saved.clear ();
-  }
-}
-
 #ifndef NDEBUG
 void Internal::test_watch_invariant () {
   // does not hold for opts.chrono of course...
@@ -112,26 +89,28 @@ void Internal::test_watch_invariant () {
   if (opts.chrono > 0 && !repairing)
     return;
   for (auto lit : lits) {
-    Watches &ws = watches (lit);
     // last literal might not be propagated to completion
     if ((size_t) var (lit).trail >= propagated - 1)
       continue;
-    for (auto w : ws) {
-      if (w.clause->garbage)
-        continue;
-      // if (w.clause == conflict) continue;
-      // int blit = w.blit;
-      LOG (w.clause, "watch lit %d blit %d in", lit, w.blit);
-      assert (w.clause->literals[0] == lit || w.clause->literals[1] == lit);
-      int witness = 0;
-      for (const auto &ok : *w.clause) {
-        if (val (ok) > 0) {
-          if (var (ok).level <= var (lit).level) {
-            witness = ok;
+    for (int binary = 0; binary < 2; binary++) {
+      for (auto w : binary ? bwatches (lit) : watches (lit)) {
+        if (watched (w)->garbage)
+          continue;
+        // if (watched (w) == conflict) continue;
+        // int blit = w.blit;
+        LOG (watched (w), "watch lit %d blit %d in", lit, w.blit);
+        assert (watched (w)->literals[0] == lit ||
+                watched (w)->literals[1] == lit);
+        int witness = 0;
+        for (const auto &ok : *watched (w)) {
+          if (val (ok) > 0) {
+            if (var (ok).level <= var (lit).level) {
+              witness = ok;
+            }
           }
         }
+        assert (val (lit) >= 0 || witness);
       }
-      assert (val (lit) >= 0 || witness);
     }
   }
 }
@@ -15,6 +15,16 @@ namespace CaDiCaL {
 // to use at least one more bit (either taken away from the variable space
 // or the clauses) to denote whether the watch is binary.
 
+// This alternative is available as compile time option through
+// './configure --compact-watches' which defines 'COMPACT_WATCHES'.  Then
+// all clauses are allocated permanently in the clause arena (see
+// 'arena.hpp') and watches only hold the blocking literal and a 32-bit
+// reference to the clause in the arena.  The least significant bit of the
+// reference denotes binary watches.  This halves the size of watches to 8
+// bytes but restricts clause memory to 16 GB.  In both modes the watched
+// clause is obtained through 'Internal::watched' and watches are created
+// with 'Internal::make_watch' (see 'internal.hpp').
+
 // in fashion of Intel Sat 10.4230/LIPIcs.SAT.2022.8 we try to
 // guarantee the following invariant:
 // For both watches:
@@ -26,6 +36,23 @@ namespace CaDiCaL {
 
 struct Clause;
 
+#ifdef COMPACT_WATCHES
+
+struct Watch {
+
+  int blit;
+  unsigned ref; // twice arena reference of clause plus binary flag
+
+  Watch (int b, unsigned r, bool binary)
+      : blit (b), ref ((r << 1) | (unsigned) binary) {}
+  Watch () {}
+
+  bool binary () const { return ref & 1; }
+  unsigned reference () const { return ref >> 1; }
+};
+
+#else
+
 struct Watch {
 
   Clause *clause;
@@ -38,35 +65,13 @@ struct Watch {
   bool binary () const { return size == 2; }
 };
 
+#endif
+
 typedef vector<Watch> Watches; // of one literal
 
 typedef Watches::iterator watch_iterator;
 typedef Watches::const_iterator const_watch_iterator;
 
-inline void remove_watch (Watches &ws, Clause *clause) {
-  const auto end = ws.end ();
-  auto i = ws.begin ();
-  for (auto j = i; j != end; j++) {
-    const Watch &w = *i++ = *j;
-    if (w.clause == clause)
-      i--;
-  }
-  assert (i + 1 == end);
-  ws.resize (i - ws.begin ());
-}
-
-// search for the clause and updates the size marked in the watch lists
-inline void update_watch_size (Watches &ws, int blit, Clause *conflict) {
-  bool found = false;
-  const int size = conflict->size;
-  for (Watch &w : ws) {
-    if (w.clause == conflict)
-      w.size = size, w.blit = blit, found = true;
-    assert (w.clause->garbage || w.size == 2 || w.clause->size != 2);
-  }
-  assert (found), (void) found;
-}
-
 } // namespace CaDiCaL
 
 #endif
@@ -0,0 +1,110 @@
+#include "../../src/cadical.hpp"
+
+#include <iostream>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+extern "C" {
+#include <assert.h>
+}
+
+// Exports learned clauses of one solver and imports them into another.
+
+class Exchange : CaDiCaL::Learner, CaDiCaL::Importer {
+  CaDiCaL::Solver *from, *to;
+  std::vector<int> clauses, clause;
+  size_t next;
+
+public:
+  unsigned exported, imported;
+  Exchange (CaDiCaL::Solver *f, CaDiCaL::Solver *t)
+      : from (f), to (t), next (0), exported (0), imported (0) {
+    from->connect_learner (this);
+    to->connect_importer (this);
+  }
+  ~Exchange () {
+    from->disconnect_learner ();
+    to->disconnect_importer ();
+  }
+  bool learning (int size) { return 0 < size && size <= 8; }
+  void learn (int lit) {
+    if (lit)
+      clause.push_back (lit);
+    else {
+      for (auto other : clause)
+        clauses.push_back (other);
+      clauses.push_back (0);
+      clause.clear ();
+      exported++;
+    }
+  }
+  bool importing () {
+    if (next == clauses.size ())
+      return false;
+    imported++;
+    return true;
+  }
+  int import () { return clauses[next++]; }
+};
+
+// Pigeon hole formula with 'n + 1' pigeons and 'n' holes.
+
+static void pigeon_hole (CaDiCaL::Solver &solver, int n) {
+  auto var = [n] (int p, int h) { return p * n + h + 1; };
+  for (int p = 0; p <= n; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (var (p, h));
+    solver.add (0);
+  }
+  for (int h = 0; h < n; h++)
+    for (int p = 0; p <= n; p++)
+      for (int q = p + 1; q <= n; q++)
+        solver.add (-var (p, h)), solver.add (-var (q, h)), solver.add (0);
+}
+
+// Satisfiable formula with root-level units and thus with units on the
+// extension stack of the copy.
+
+static const int satisfiable[] = {1,  0,  -1, 2,  0,  -2, 3,  4,  0,
+                                  -3, -4, 0,  3,  -5, 0,  4,  5,  0,
+                                  -2, 6,  7,  0,  -6, -7, 0,  0};
+
+int main () {
+
+  CaDiCaL::Solver ping, pong;
+  ping.set ("restartint", 1);
+  pigeon_hole (ping, 6);
+  ping.copy (pong);
+  Exchange exchange (&ping, &pong);
+  int a = ping.solve ();
+  std::cout << "ping returns " << a << " after exporting "
+            << exchange.exported << " clauses" << std::endl;
+  int b = pong.solve ();
+  std::cout << "pong returns " << b << " after importing "
+            << exchange.imported << " clauses" << std::endl;
+  assert (a == 20), assert (b == 20);
+  assert (exchange.exported > 0);
+  assert (exchange.imported > 0);
+
+  CaDiCaL::Solver original, copy;
+  for (const int *p = satisfiable; p[0] || p[1]; p++)
+    original.add (*p);
+  original.add (0);
+  assert (original.simplify () == 0);
+  original.copy (copy);
+  int c = copy.solve ();
+  std::cout << "copy returns " << c << std::endl;
+  assert (c == 10);
+  bool satisfied = false;
+  for (const int *p = satisfiable; p[0] || p[1]; p++)
+    if (!*p)
+      assert (satisfied), satisfied = false;
+    else if (copy.val (*p) > 0)
+      satisfied = true;
+  assert (satisfied);
+
+  return 0;
+}
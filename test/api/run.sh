@@ -47,6 +47,7 @@ makefile=$CADICALBUILD/makefile
 
 CXX=`grep '^CXX=' "$makefile"|sed -e 's,CXX=,,'`
 CXXFLAGS=`grep '^CXXFLAGS=' "$makefile"|sed -e 's,CXXFLAGS=,,'`
+LIBS=`grep '^LIBS=' "$makefile"|sed -e 's,LIBS=,,'`
 
 msg "using CXX=$CXX"
 msg "using CXXFLAGS=$CXXFLAGS"
@@ -86,7 +87,7 @@ run () {
   rm -f $name.log $name.o $name
   status=0
   cmd $COMPILE$language -o $name.o -c $src
-  cmd $COMPILE -o $name $name.o -L$CADICALBUILD -lcadical
+  cmd $COMPILE -o $name $name.o -L$CADICALBUILD -lcadical $LIBS
   cmd $name
   if test $status = 0
   then
@@ -109,6 +110,8 @@ run example_constraint
 run example_tracer
 run terminate
 run learn
+run ticks
+run import
 run cfreeze
 run traverse
 run cipasir
@@ -0,0 +1,51 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+extern "C" {
+#include <assert.h>
+}
+
+// Solve a pigeon hole formula in time slices bounded by 'ticks'.  Each
+// slice but the last returns '0' and the next 'solve' resumes the search.
+// Since ticks are deterministic the number of slices has to be the same
+// for two solvers.
+
+static int n = 7;
+
+static int ph (int p, int h) {
+  assert (0 <= p), assert (p < n + 1);
+  assert (0 <= h), assert (h < n);
+  return 1 + h * (n + 1) + p;
+}
+
+static int slices (int ticks) {
+  CaDiCaL::Solver solver;
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        solver.add (-ph (p1, h)), solver.add (-ph (p2, h)), solver.add (0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      solver.add (ph (p, h));
+    solver.add (0);
+  }
+  int res = 0, count = 0;
+  while (!res) {
+    bool valid = solver.limit ("ticks", ticks);
+    assert (valid);
+    res = solver.solve ();
+    count++;
+  }
+  assert (res == 20);
+  return count;
+}
+
+int main () {
+  const int count = slices (1e4);
+  assert (count > 1);
+  assert (slices (1e4) == count);
+  return 0;
+}